@@ -22,12 +22,18 @@
 #include "../population/AbstractPopulation.h"
 #include "../checkpoint/Checkpoint.h"
 #include "../composite/Composite.h"
+#include "../evaluator/EvaluationPool.h"
+#include "../fitness/FitnessCache.h"
 
 #include <stdexcept>
 #include <memory>
 #include <thread>
 #include <cmath>
 #include <mutex>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 
 
 /// @brief Abstract base class to represent an evolutionary algorithm (EA) 
@@ -43,12 +49,24 @@
 template<class E, class G, class F>
 class EvolutionaryAlgorithm {
 protected:
+	/// @brief Random stream and variation operators of a breeding task.
+	struct Breeder {
+		std::shared_ptr<Random> random;
+		std::shared_ptr<Mutation<G, F>> mutation;
+		std::shared_ptr<Recombination<G, F>> recombination;
+		int skipped_evaluations = 0;
+	};
+
+	// Stream index of the draws made by the selection in a generation
+	static constexpr std::uint32_t SELECTION_STREAM = 0xffffffff;
+
 	long long max_fitness_evaluations;
 	long long max_generations;
 	int report_interval;
 	int generation_number;
 	int fitness_evaluations;
-	int eval_chunk_size;
+	int skipped_evaluations;
+	int pruned_evaluations;
 
 	bool report_during_job;
 	bool is_ideal = false;
@@ -58,6 +76,26 @@ protected:
 	F ideal_fitness;
 	F best_fitness;
 
+	// Offspring that exceed the cut-off bound are pruned when racing is enabled
+	bool racing;
+	F cutoff_bound;
+
+	// Individuals are evaluated on mini-batches that change every batch_interval generations
+	bool batching;
+	int batch_interval;
+
+	// Offspring are screened on a few instances and only contenders are fully evaluated
+	bool screening;
+	float screening_margin;
+	int screened_evaluations;
+	int generation_screened;
+	int generation_candidates;
+	std::vector<F> screening_fitness;
+
+	// Offspring are bred concurrently, each from its own counter-based random stream
+	bool parallel_breeding;
+	std::vector<Breeder> breeders;
+
 	std::string name;
 
 	std::shared_ptr<Random> random;
@@ -76,19 +114,37 @@ protected:
 
 	std::shared_ptr<Checkpoint<E, G, F>> checkpoint;
 
+	std::unique_ptr<EvaluationPool<E, G, F>> evaluation_pool;
+
+	std::shared_ptr<FitnessCache<F>> fitness_cache;
+
+	// Snapshots of improved best individuals are validated on test data in the background
+	std::shared_ptr<TestValidator<E, G, F>> validator;
+	bool submitting_snapshots;
+	F snapshot_fitness;
+
 	std::shared_ptr<Composite<E, G, F>> composite;
 	std::vector<Individual<G, F>> offsprings;
 
+	// Best evaluated individual selected in the most recent generation
+	std::shared_ptr<Individual<G, F>> best_individual;
+
 
 	void report(int generation_number);
-	void check_ideal(int generation_number);
+	void check_ideal(int generation_number,
+			const std::shared_ptr<Individual<G, F>> &best);
 	void check_checkpoint();
-	void decode();
 	void evaluate();
 	void evaluate_concurrent();
-	void evaluate_chunk(std::vector<std::shared_ptr<Individual<G, F> > > chunk,
-			BlackBoxProblem<E, G, F> &p);
 	void evaluate_consecutive();
+	void submit_snapshot(const std::shared_ptr<Individual<G, F>> &best);
+	bool advance_batch();
+	void update_racing();
+	void screen();
+	void open_selection_stream();
+
+	template<class B>
+	void breed_streams(int num_offspring, B breed_offspring);
 
 	virtual void breed(int num_offspring) = 0;
 
@@ -100,6 +156,12 @@ public:
 	virtual const std::string& get_name() const;
 	int get_generation_number() const;
 	void set_generation_number(int p_generation_number);
+	int get_skipped_evaluations() const;
+	int get_pruned_evaluations() const;
+	int get_screened_evaluations() const;
+	std::shared_ptr<FitnessCache<F>> get_fitness_cache() const;
+	const EvaluationPool<E, G, F>* get_evaluation_pool() const;
+	const std::shared_ptr<Individual<G, F>>& get_best_individual() const;
 
 };
 
@@ -129,6 +191,7 @@ EvolutionaryAlgorithm<E, G, F>::EvolutionaryAlgorithm(
 	species = composite->get_species();
 	evaluator = composite->get_evaluator();
 	checkpoint = composite->get_checkpoint();
+	validator = composite->get_validator();
 
 	max_fitness_evaluations = parameters->get_max_fitness_evaluations();
 	max_generations = parameters->get_max_generations();
@@ -138,11 +201,70 @@ EvolutionaryAlgorithm<E, G, F>::EvolutionaryAlgorithm(
 	report_during_job = parameters->is_report_during_job();
 
 	fitness_evaluations = 0;
+	skipped_evaluations = 0;
+	pruned_evaluations = 0;
+	screened_evaluations = 0;
+	generation_screened = 0;
+	generation_candidates = 0;
 	generation_number = 1;
 
-	eval_chunk_size = std::trunc(
-			this->parameters->get_population_size()
-					/ this->parameters->get_num_eval_threads());
+	racing = parameters->is_racing_evaluation()
+			&& parameters->is_minimizing_fitness();
+	cutoff_bound = std::numeric_limits<F>::max();
+
+	// Intermediate snapshots are only written to the statfile
+	submitting_snapshots = validator != nullptr && parameters->is_write_statfile();
+	snapshot_fitness = fitness->worst_value();
+
+	// The cache is set before the problem is cloned for the evaluation threads
+	if (this->parameters->get_fitness_cache_size() > 0) {
+		fitness_cache = std::make_shared<FitnessCache<F>>(
+				this->parameters->get_fitness_cache_size());
+		problem->set_fitness_cache(fitness_cache);
+	}
+
+	// The mini-batches are set before the problem is cloned for the evaluation threads
+	if (this->parameters->get_batch_size() > 0) {
+		if (this->parameters->get_batch_interval() < 1) {
+			throw std::invalid_argument("Batch interval must be positive!");
+		}
+
+		problem->init_batches(this->parameters->get_batch_size());
+	}
+
+	batching = problem->is_batched();
+	batch_interval = this->parameters->get_batch_interval();
+
+	screening = this->parameters->get_screening_size() > 0;
+	screening_margin = this->parameters->get_screening_margin();
+
+	if (screening) {
+		problem->set_screening_size(this->parameters->get_screening_size());
+	}
+
+	// The evaluation threads are created once and reused for all generations and jobs
+	if (this->parameters->get_num_eval_threads() > 1) {
+		evaluation_pool = std::make_unique<EvaluationPool<E, G, F>>(problem,
+				this->parameters->get_num_eval_threads());
+	}
+
+	// One breeder per evaluation thread, the operators keep scratch space per breeder
+	parallel_breeding = this->parameters->is_parallel_breeding();
+
+	if (parallel_breeding) {
+		int num_breeders = evaluation_pool != nullptr ? evaluation_pool->size() : 1;
+
+		for (int i = 0; i < num_breeders; i++) {
+			Breeder breeder;
+			breeder.random = std::make_shared<Random>(random->get_global_seed(),
+					this->parameters);
+			breeder.mutation = std::make_shared<Mutation<G, F>>(this->parameters,
+					breeder.random, species);
+			breeder.recombination = std::make_shared<Recombination<G, F>>(
+					this->parameters, breeder.random, species);
+			breeders.push_back(breeder);
+		}
+	}
 
 	if (this->parameters->is_checkpointing()) {
 		checkpointing = this->parameters->is_checkpointing();
@@ -154,12 +276,15 @@ EvolutionaryAlgorithm<E, G, F>::EvolutionaryAlgorithm(
 }
 
 
-/// @brief Triggers the CGP decoding and starts the evaluation 
-/// either in a consecutive or concurrent fashion  
+/// @brief Starts the evaluation either in a consecutive or concurrent fashion  
+/// @details Individuals are decoded by the problem instance that evaluates them
+/// (see BlackBoxProblem::evaluate_individual()).
 template<class E, class G, class F>
 void EvolutionaryAlgorithm<E, G, F>::evaluate() {
 
-	this->decode();
+	if (this->screening) {
+		this->screen();
+	}
 
 	if (parameters->get_num_eval_threads() == 1) {
 		this->evaluate_consecutive();
@@ -168,87 +293,299 @@ void EvolutionaryAlgorithm<E, G, F>::evaluate() {
 	}
 }
 
-/// @brief Decodes the individuals of the CGP by calling the decoder of the evaluator 
+/// @brief Evaluates the individuals by using conurrency 
+/// @details Each individual that has to be evaluated is submitted as a task to the
+/// persistent evaluation pool, with its estimated cost as hint for the scheduling
+/// (see BlackBoxProblem::evaluation_cost()). The most expensive individuals are
+/// submitted first, so the pool can balance the costs across the workers. Returns 
+/// when all individuals have been evaluated. 
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::decode() {
-	std::shared_ptr<Individual<G, F>> individual;
+void EvolutionaryAlgorithm<E, G, F>::evaluate_concurrent() {
+
+	std::vector<std::pair<double, int>> costs;
 
+	for (int i = 0; i < this->population->size(); i++) {
+		std::shared_ptr<Individual<G, F>> individual =
+				this->population->get_individual(i);
+
+		if (!individual->is_evaluated()) {
+			costs.emplace_back(this->problem->evaluation_cost(individual), i);
+		}
+	}
+
+	std::stable_sort(costs.begin(), costs.end(),
+			[](const std::pair<double, int> &a, const std::pair<double, int> &b) {
+				return a.first > b.first;
+			});
+
+	std::vector<typename EvaluationPool<E, G, F>::Task> tasks;
+	std::vector<double> task_costs;
+
+	for (const std::pair<double, int> &cost : costs) {
+		std::shared_ptr<Individual<G, F>> individual =
+				this->population->get_individual(cost.second);
+
+		tasks.push_back([this, individual](BlackBoxProblem<E, G, F> &p) {
+			p.evaluate_individual(individual, this->cutoff_bound);
+		});
+		task_costs.push_back(cost.first);
+	}
+
+	this->evaluation_pool->submit_all(tasks, task_costs);
+	this->evaluation_pool->wait();
+}
+
+/// @details Evaluates the population in a consectutive fashion. 
+template<class E, class G, class F>
+void EvolutionaryAlgorithm<E, G, F>::evaluate_consecutive() {
+	std::shared_ptr<Individual<G, F>> individual;
 	for (int i = 0; i < this->population->size(); i++) {
 		individual = this->population->get_individual(i);
-		this->evaluator->decode_path(individual);
+		this->problem->evaluate_individual(individual, this->cutoff_bound);
 	}
 }
 
-/// @brief Evaluates the individuals by using conurrency 
-/// @details A thread pool is created by chunking the population 
-/// and evaluating each chunk in each thread. The thread pool is then
-/// synchronized. 
+/// @details Resets the number of generation and fitness evaluations and the 
+/// utilization of the evaluation threads. 
+/// The random streams of the next job are separated by a new epoch.
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::evaluate_concurrent() {
+void EvolutionaryAlgorithm<E, G, F>::reset() {
+	this->random->set_stream_epoch(this->random->get_stream_epoch() + 1);
+	this->generation_number = 1;
+	this->fitness_evaluations = 0;
+	this->skipped_evaluations = 0;
+	this->pruned_evaluations = 0;
+	this->screened_evaluations = 0;
+	this->snapshot_fitness = this->fitness->worst_value();
+	this->best_individual = nullptr;
+
+	if (this->fitness_cache != nullptr) {
+		this->fitness_cache->clear();
+	}
 
-	std::shared_ptr<Individual<G, F>> individual;
-	std::vector<std::thread> threads;
+	if (this->evaluation_pool != nullptr) {
+		this->evaluation_pool->reset_statistics();
+	}
+}
 
-	int num_eval_threads = parameters->get_num_eval_threads();
-	int num_individuals = this->population->size();
+/// @brief Passes the best individual to the test validator if its fitness has improved.
+/// @details The validator copies the individual and returns immediately.
+/// @param best best individual of the current generation
+template<class E, class G, class F>
+void EvolutionaryAlgorithm<E, G, F>::submit_snapshot(
+		const std::shared_ptr<Individual<G, F>> &best) {
 
-	int start;
-	int n;
+	if (!this->submitting_snapshots
+			|| !this->fitness->is_better(best->get_fitness(),
+					this->snapshot_fitness)) {
+		return;
+	}
+
+	this->snapshot_fitness = best->get_fitness();
+	this->validator->submit(best, this->generation_number);
+}
 
-	for (int i = 0; i < num_eval_threads; i++) {
+/// @brief Screens the unevaluated individuals before their full evaluation.
+/// @details The evaluated individuals (the parents) and the unevaluated offspring are
+/// scored on the screening instances of the problem. Offspring whose screening fitness
+/// is not within the margin of the mu-th best parent are rejected: they are marked as
+/// evaluated and screened with the screening fitness, which excludes them from the
+/// selection. The remaining offspring are evaluated on all instances afterwards.
+/// Nothing is screened as long as no parent has been evaluated.
+template<class E, class G, class F>
+void EvolutionaryAlgorithm<E, G, F>::screen() {
 
-		start = i * this->eval_chunk_size;
-		n = this->eval_chunk_size;
+	std::vector<int> parents;
+	std::vector<int> candidates;
 
-		if (i == num_eval_threads - 1 && (start + n) != num_individuals) {
-			n = num_individuals - start;
+	this->generation_screened = 0;
+	this->generation_candidates = 0;
+
+	for (int i = 0; i < this->population->size(); i++) {
+		std::shared_ptr<Individual<G, F>> individual =
+				this->population->get_individual(i);
+
+		if (!individual->is_evaluated()) {
+			candidates.push_back(i);
+		} else if (!individual->is_screened()) {
+			parents.push_back(i);
 		}
+	}
 
-		std::vector<std::shared_ptr<Individual<G, F> > > chunk;
-		BlackBoxProblem<E, G, F> *p = this->problem->clone();
+	if (parents.empty() || candidates.empty()) {
+		return;
+	}
 
-		for (int i = start; i < start + n; i++) {
-			individual = this->population->get_individual(i);
-			chunk.push_back(individual);
+	this->screening_fitness.resize(this->population->size());
+
+	for (const std::vector<int> *indices : { &parents, &candidates }) {
+		for (int i : *indices) {
+			std::shared_ptr<Individual<G, F>> individual =
+					this->population->get_individual(i);
+
+			if (this->evaluation_pool != nullptr) {
+				this->evaluation_pool->submit(
+						[this, individual, i](BlackBoxProblem<E, G, F> &p) {
+							this->screening_fitness[i] = p.screen_individual(
+									individual);
+						});
+			} else {
+				this->screening_fitness[i] = this->problem->screen_individual(
+						individual);
+			}
 		}
+	}
 
-		std::thread t = std::thread([=]() {
-			this->evaluate_chunk(chunk, *p);
-		});
-		threads.push_back(std::move(t));
+	if (this->evaluation_pool != nullptr) {
+		this->evaluation_pool->wait();
 	}
 
-	for (auto &t : threads) {
-		t.join();
+	// Screening fitness of the mu-th best parent
+	std::vector<F> parent_fitness;
+	for (int i : parents) {
+		parent_fitness.push_back(this->screening_fitness[i]);
 	}
+
+	bool minimizing = this->parameters->is_minimizing_fitness();
+
+	int k = std::min((int) parent_fitness.size(), this->parameters->get_mu())
+			- 1;
+	std::nth_element(parent_fitness.begin(), parent_fitness.begin() + k,
+			parent_fitness.end(), [minimizing](F a, F b) {
+				return minimizing ? a < b : a > b;
+			});
+
+	F reference = parent_fitness[k];
+	F margin = this->screening_margin * std::abs(reference);
+	F threshold = minimizing ? reference + margin : reference - margin;
+
+	for (int i : candidates) {
+		F screened_fitness = this->screening_fitness[i];
+
+		if (minimizing ?
+				screened_fitness <= threshold : screened_fitness >= threshold) {
+			continue;
+		}
+
+		std::shared_ptr<Individual<G, F>> individual =
+				this->population->get_individual(i);
+
+		individual->set_fitness(screened_fitness);
+		individual->set_evaluated(true);
+		individual->set_pruned(false);
+		individual->set_screened(true);
+		individual->set_hits(-1);
+
+		this->generation_screened++;
+	}
+
+	this->generation_candidates = candidates.size();
+	this->screened_evaluations += this->generation_screened;
 }
 
-/// @brief Evaluates a chunk of individuals within a thread. 
+/// @brief Draws the selection of the current generation from its own random stream.
+/// @details Only used with parallel breeding. The draws of a generation then only
+/// depend on the seed, the epoch and the generation number, so a run resumed from a
+/// checkpoint continues exactly.
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::evaluate_chunk(
-		std::vector<std::shared_ptr<Individual<G, F> > > chunk,
-		BlackBoxProblem<E, G, F> &p) {
+void EvolutionaryAlgorithm<E, G, F>::open_selection_stream() {
+	if (this->parallel_breeding) {
+		this->random->set_stream(this->generation_number, SELECTION_STREAM);
+	}
+}
+
+/// @brief Breeds the offspring concurrently from per-offspring random streams.
+/// @details The offspring are split into contiguous chunks, one per breeder, that are
+/// bred by the evaluation threads. Before an offspring is bred, the random generator
+/// of the breeder is set to the stream of the offspring index in the current
+/// generation, so the offspring do not depend on the number of threads.
+/// @param num_offspring number of offspring
+/// @param breed_offspring function that breeds one offspring with a breeder,
+/// called as breed_offspring(breeder, index)
+template<class E, class G, class F>
+template<class B>
+void EvolutionaryAlgorithm<E, G, F>::breed_streams(int num_offspring,
+		B breed_offspring) {
+
+	int num_breeders = this->breeders.size();
+	int chunk_size = (num_offspring + num_breeders - 1) / num_breeders;
+
+	long long seed = this->random->get_global_seed();
+	long long epoch = this->random->get_stream_epoch();
+	int generation = this->generation_number;
+
+	for (int k = 0; k < num_breeders; k++) {
+		int start = k * chunk_size;
+		int end = std::min(start + chunk_size, num_offspring);
 
-	for (auto it = chunk.begin(); it != chunk.end(); ++it) {
-		p.evaluate_individual(*it);
+		if (start >= end) {
+			break;
+		}
+
+		Breeder *breeder = &this->breeders[k];
+
+		auto task = [=]() {
+			for (int i = start; i < end; i++) {
+				breeder->random->set_stream(seed, epoch, generation, i);
+				breed_offspring(*breeder, i);
+			}
+		};
+
+		if (this->evaluation_pool != nullptr) {
+			this->evaluation_pool->submit([task](BlackBoxProblem<E, G, F>&) {
+				task();
+			});
+		} else {
+			task();
+		}
+	}
+
+	if (this->evaluation_pool != nullptr) {
+		this->evaluation_pool->wait();
+	}
+
+	for (Breeder &breeder : this->breeders) {
+		this->skipped_evaluations += breeder.skipped_evaluations;
+		breeder.skipped_evaluations = 0;
 	}
 }
 
-/// @details Evaluates the population in a consectutive fashion. 
+/// @brief Moves the evaluation to the next mini-batch when the batch interval has passed.
+/// @details The whole population is re-evaluated on the new batch, so that the parents
+/// are compared with their offspring on the same instances. No individual is pruned 
+/// in the re-evaluation since the fitness of the previous batch is no valid bound.
+/// @return true if the batch has changed
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::evaluate_consecutive() {
-	std::shared_ptr<Individual<G, F>> individual;
+bool EvolutionaryAlgorithm<E, G, F>::advance_batch() {
+
+	if (!this->batching || this->generation_number <= 1
+			|| (this->generation_number - 1) % this->batch_interval != 0) {
+		return false;
+	}
+
+	this->problem->next_batch();
+
 	for (int i = 0; i < this->population->size(); i++) {
-		individual = this->population->get_individual(i);
-		this->problem->evaluate_individual(individual);
+		this->population->get_individual(i)->set_evaluated(false);
 	}
+
+	this->cutoff_bound = this->fitness->worst_value();
+	this->snapshot_fitness = this->fitness->worst_value();
+
+	return true;
 }
 
-/// @details Resets the number of generation and fitness evaluations. 
+/// @brief Counts the pruned offspring and reorders the instances for racing.
+/// @details Called between the evaluations, while no evaluation thread is busy.
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::reset() {
-	this->generation_number = 1;
-	this->fitness_evaluations = 0;
+void EvolutionaryAlgorithm<E, G, F>::update_racing() {
+	for (int i = 0; i < this->population->size(); i++) {
+		if (this->population->get_individual(i)->is_pruned()) {
+			this->pruned_evaluations++;
+		}
+	}
+
+	this->problem->update_instance_order();
 }
 
 /// @brief Reports the current status of the EA 
@@ -259,9 +596,18 @@ void EvolutionaryAlgorithm<E, G, F>::report(int generation_number) {
 	if (this->report_during_job) {
 		if (generation_number % this->report_interval == 0) {
 			
-			//get best individual
-			this->population->sort();
-            auto best_ind = this->population->get_individual(0);
+			// Get the best individual without reordering the population, since the
+			// index of the selected parent must stay valid for the breeding
+			auto best_ind = this->population->get_individual(0);
+			for (int i = 1; i < this->population->size(); i++) {
+				auto individual = this->population->get_individual(i);
+				if (best_ind->is_screened() && !individual->is_screened()) {
+					best_ind = individual;
+				} else if (best_ind->is_screened() == individual->is_screened()
+						&& individual->get_fitness() < best_ind->get_fitness()) {
+					best_ind = individual;
+				}
+			}
 
 			//get best fitness
 			F best_fitness = this->best_fitness;
@@ -269,14 +615,29 @@ void EvolutionaryAlgorithm<E, G, F>::report(int generation_number) {
 			// Recupera il problema dal composite
             auto problem = this->composite->get_problem();
 
+			// The best individual is scored on all instances at the report interval
+			if (this->batching) {
+				best_ind = problem->evaluate_full(best_ind);
+			}
+
 			// Recupera numero campioni e calcola hits
-                int total_samples = problem->get_num_instances();
+                int total_samples = problem->get_num_samples();
                 int hits = problem->validate_individual(best_ind);
                 
                 std::stringstream ss;
                 ss << "Generation # " << generation_number 
                    << " :: Best Fitness (Score): " << best_fitness;
 
+                if (this->batching) {
+                    ss << " :: Full Fitness: " << best_ind->get_fitness();
+                }
+
+                // Full evaluations saved by the screening in this generation
+                if (this->screening) {
+                    ss << " :: Screened Out: " << this->generation_screened
+                       << "/" << this->generation_candidates;
+                }
+
                 // Stampa accuracy solo se supportata (hits != -1)
                 if (hits != -1) {
                     double accuracy = (double)hits / total_samples * 100.0;
@@ -291,10 +652,18 @@ void EvolutionaryAlgorithm<E, G, F>::report(int generation_number) {
 }
 
 /// @brief Checks for the predefined ideal fitness.  
+/// @details With mini-batches, an ideal fitness on the batch is confirmed on all instances.
+/// @param best individual with the best fitness
 template<class E, class G, class F>
-void EvolutionaryAlgorithm<E, G, F>::check_ideal(int generation_number) {
+void EvolutionaryAlgorithm<E, G, F>::check_ideal(int generation_number,
+		const std::shared_ptr<Individual<G, F>> &best) {
 	this->is_ideal = this->fitness->is_ideal(this->best_fitness);
 
+	if (this->is_ideal && this->batching) {
+		F full_fitness = this->problem->evaluate_full(best)->get_fitness();
+		this->is_ideal = this->fitness->is_ideal(full_fitness);
+	}
+
 	if (this->is_ideal) {
 		if (this->report_during_job) {
 			std::cout << "Ideal fitness has been reached in generation # "
@@ -304,12 +673,14 @@ void EvolutionaryAlgorithm<E, G, F>::check_ideal(int generation_number) {
 }
 
 /// @brief Checks whether a new checkpoing should be triggered. 
-/// @details Checkpoint interval is predefined by a checkpoint modulo. 
+/// @details Checkpoint interval is predefined by a checkpoint modulo. Called after 
+/// the breeding, so the checkpoint holds the population of the next generation.
 template<class E, class G, class F>
 void EvolutionaryAlgorithm<E, G, F>::check_checkpoint() {
 	if (this->checkpointing) {
 		if (this->generation_number % this->checkpoint_modulo == 0) {
-			this->checkpoint->write(this->population, this->constants, this->generation_number);
+			this->checkpoint->write(this->population, this->constants,
+					this->random, this->generation_number + 1);
 
 			if (this->report_during_job) {
 				std::cout << "Checkpoint written at generation # "
@@ -332,6 +703,46 @@ int EvolutionaryAlgorithm<E, G, F>::get_generation_number() const {
 	return this->generation_number;
 }
 
+/// @brief Returns the number of offspring that inherited the fitness of their
+/// parent because the mutation did not change an active gene.
+template<class E, class G, class F>
+int EvolutionaryAlgorithm<E, G, F>::get_skipped_evaluations() const {
+	return this->skipped_evaluations;
+}
+
+/// @brief Returns the number of evaluations that have been aborted by racing.
+template<class E, class G, class F>
+int EvolutionaryAlgorithm<E, G, F>::get_pruned_evaluations() const {
+	return this->pruned_evaluations;
+}
+
+/// @brief Returns the number of offspring that have been rejected by the screening.
+template<class E, class G, class F>
+int EvolutionaryAlgorithm<E, G, F>::get_screened_evaluations() const {
+	return this->screened_evaluations;
+}
+
+/// @brief Returns the fitness cache of the job or nullptr if caching is disabled.
+template<class E, class G, class F>
+std::shared_ptr<FitnessCache<F>> EvolutionaryAlgorithm<E, G, F>::get_fitness_cache() const {
+	return this->fitness_cache;
+}
+
+/// @brief Returns the best evaluated individual of the most recent generation.
+/// @details After the breeding, the population also holds offspring that have not
+/// been evaluated yet, so the best individual is taken from the selection instead.
+/// @return best individual, nullptr if no generation has been evaluated in the job
+template<class E, class G, class F>
+const std::shared_ptr<Individual<G, F>>& EvolutionaryAlgorithm<E, G, F>::get_best_individual() const {
+	return this->best_individual;
+}
+
+/// @brief Returns the evaluation pool or nullptr if the evaluation is not concurrent.
+template<class E, class G, class F>
+const EvaluationPool<E, G, F>* EvolutionaryAlgorithm<E, G, F>::get_evaluation_pool() const {
+	return this->evaluation_pool.get();
+}
+
 
 template<class E, class G, class F>
 void EvolutionaryAlgorithm<E, G, F>::set_generation_number(int p_generation_number) {
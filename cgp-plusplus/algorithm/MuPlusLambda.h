@@ -15,6 +15,8 @@
 
 #include "EvolutionaryAlgorithm.h"
 
+#include <algorithm>
+
 /// @brief Provides a mu+lambda ES that is used to enable crossover-based CGP. 
 
 /// @details This implementation follows the defintion of a mu+lambda EA 
@@ -34,8 +36,10 @@ private:
 	int mu;
 	int lambda;
 
-	int select_parent();
+	int select_parent(Random &p_random);
 	void breed(int num_offspring) override;
+	void breed_offspring(Random &p_random, Mutation<G, F> &p_mutation,
+			Recombination<G, F> &p_recombination, int index, int &skipped);
 public:
 	MuPlusLambda(std::shared_ptr<Composite<E, G, F>> p_composite);
 	virtual ~MuPlusLambda() = default;
@@ -55,37 +59,70 @@ MuPlusLambda<E, G, F>::MuPlusLambda(
 }
 
 template<class E, class G, class F>
-int MuPlusLambda<E, G, F>::select_parent() {
-	return this->random->random_integer(0, this->mu - 1);
+int MuPlusLambda<E, G, F>::select_parent(Random &p_random) {
+	return p_random.random_integer(0, this->mu - 1);
 }
 
 /// @brief Breeds new offspring by recombination and mutation by 
 /// selecting from the parent population. 
+/// @details The offspring overwrite the individuals behind the mu parents in place.
+/// Only the first child of the recombination is kept, so the second one is not built.
 template<class E, class G, class F>
 void MuPlusLambda<E, G, F>::breed(int num_offspring) {
 
+	if (this->parallel_breeding) {
+		this->breed_streams(num_offspring,
+				[this](typename EvolutionaryAlgorithm<E, G, F>::Breeder &breeder,
+						int i) {
+					this->breed_offspring(*breeder.random, *breeder.mutation,
+							*breeder.recombination, i,
+							breeder.skipped_evaluations);
+				});
+		return;
+	}
+
 	for (int i = 0; i < num_offspring; i++) {
+		this->breed_offspring(*this->random, *this->mutation,
+				*this->recombination, i, this->skipped_evaluations);
+	}
+}
 
-		int idx1 = this->select_parent();
-		int idx2 = this->select_parent();
+/// @brief Overwrites an offspring slot with the recombined and mutated child of two parents.
+/// @param p_random random generator used for the selection of the parents
+/// @param p_mutation mutation that is used for the offspring
+/// @param p_recombination recombination that is used for the offspring
+/// @param index index of the offspring behind the parents
+/// @param skipped counter of the skipped evaluations
+template<class E, class G, class F>
+void MuPlusLambda<E, G, F>::breed_offspring(Random &p_random,
+		Mutation<G, F> &p_mutation, Recombination<G, F> &p_recombination,
+		int index, int &skipped) {
 
-		std::shared_ptr<Individual<G, F>> p1 = this->population->get_individual(
-				idx1);
-		std::shared_ptr<Individual<G, F>> p2 = this->population->get_individual(
-				idx2);
+	int idx1 = this->select_parent(p_random);
+	int idx2 = this->select_parent(p_random);
 
-		std::shared_ptr<Individual<G, F>> o1 =
-				std::make_shared<Individual<G, F>>(p1);
+	const std::shared_ptr<Individual<G, F>> &p1 =
+			this->population->get_individual(idx1);
+	const std::shared_ptr<Individual<G, F>> &p2 =
+			this->population->get_individual(idx2);
 
-		std::shared_ptr<Individual<G, F>> o2 =
-				std::make_shared<Individual<G, F>>(p2);
+	const std::shared_ptr<Individual<G, F>> &o1 =
+			this->population->get_individual(this->mu + index);
+	o1->copy_from(*p1);
 
-		this->recombination->crossover(o1, o2);
+	p_recombination.crossover_first(o1, p2);
 
-		this->mutation->mutate(o1);
-		o1->set_evaluated(false);
+	// The phenotype can only be inherited if the crossover did not change o1
+	bool crossed = !std::equal(o1->get_genome().get(),
+			o1->get_genome().get() + this->parameters->get_genome_size(),
+			p1->get_genome().get());
+
+	MutationReport report = p_mutation.mutate(o1);
 
-		this->population->set_individual(o1, this->mu + i);
+	if (crossed || report.is_phenotype_changed() || !p1->is_evaluated()) {
+		o1->set_evaluated(false);
+	} else {
+		skipped++;
 	}
 }
 
@@ -97,8 +134,14 @@ std::pair<int, F> MuPlusLambda<E, G, F>::evolve() {
 	this->best_fitness = this->fitness->worst_value();
 	this->is_ideal = false;
 
+	this->cutoff_bound = this->fitness->worst_value();
+
 	while (this->generation_number <= this->max_generations && !this->is_ideal) {
 
+		this->open_selection_stream();
+
+		// Parents are re-evaluated when the mini-batch changes
+		this->advance_batch();
 
 		// Trigger the evaluation process
 		this->evaluate();
@@ -107,24 +150,38 @@ std::pair<int, F> MuPlusLambda<E, G, F>::evolve() {
 		// that has been used in the evaluation procedure
 		this->fitness_evaluations += this->lambda;
 
+		if (this->racing) {
+			this->update_racing();
+		}
+
 		// Sort population for the selection process
 		this->population->sort();
 
-		// Obtain best fitness from the sorted population
-		this->best_fitness = this->population->get_individual(0)->get_fitness();
+		// Offspring that cannot reach the fitness of the mu-th parent are pruned
+		if (this->racing) {
+			this->cutoff_bound = this->population->get_individual(
+					this->mu - 1)->get_fitness();
+		}
+
+		// Obtain best individual and fitness from the sorted population
+		this->best_individual = this->population->get_individual(0);
+		this->best_fitness = this->best_individual->get_fitness();
+
+		this->submit_snapshot(this->population->get_individual(0));
 
 		// Trigger reporting intermediate result results
 		this->report(this->generation_number);
 
 		// Check for ideal fitness
-		this->check_ideal(this->generation_number);
-
-		// Check for checkpoint modulo 
-		this->check_checkpoint();
+		this->check_ideal(this->generation_number,
+				this->population->get_individual(0));
 
 		// Breed lambda offspring 
 		this->breed(lambda);
 
+		// Check for checkpoint modulo 
+		this->check_checkpoint();
+
 		this->generation_number++;
 
 	}
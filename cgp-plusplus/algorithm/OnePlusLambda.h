@@ -37,14 +37,22 @@ private:
 	int parent_index;
 
 	bool neutral_genetic_drift = true;
+	bool incremental_evaluation = false;
 
 	std::multimap<F, int> fitness_map;
 	std::shared_ptr<Individual<G, F>> parent;
 
+	std::unique_ptr<NodeCache<E, G, F>> node_cache;
+	std::vector<NodeOverlay<E>> overlays;
+
 	int select_parent();
 	void create_fitness_map();
+	void evaluate_offspring();
+	void update_node_cache();
 
 	void breed(int num_offspring) override;
+	void breed_offspring(Mutation<G, F> &p_mutation, int index,
+			int &skipped);
 
 public:
 	OnePlusLambda(std::shared_ptr<Composite<E, G, F>> p_composite);
@@ -64,6 +72,15 @@ OnePlusLambda<E, G, F>::OnePlusLambda(
 	lambda = this->parameters->get_lambda();
 	this->parameters->set_population_size(1 + lambda);
 	neutral_genetic_drift = this->parameters->is_neutral_genetic_drift();
+
+	// The node values of the parent are cached for the incremental evaluation
+	incremental_evaluation = this->parameters->is_incremental_evaluation();
+
+	if (incremental_evaluation) {
+		node_cache = std::make_unique<NodeCache<E, G, F>>(this->parameters,
+				this->problem->get_num_instances());
+		overlays.resize(this->population->size());
+	}
 }
 
 /// @brief Maps the position of the individuals and the corresponding fitness.
@@ -78,6 +95,12 @@ void OnePlusLambda<E, G, F>::create_fitness_map() {
 
 	for (int i = 0; i < this->population->size(); i++) {
 		individual = this->population->get_individual(i);
+
+		// Offspring rejected by the screening cannot become the parent
+		if (individual->is_screened()) {
+			continue;
+		}
+
 		fitness = individual->get_fitness();
 		this->fitness_map.insert(std::pair<F, int>(fitness, i));
 	}
@@ -138,7 +161,61 @@ int OnePlusLambda<E, G, F>::select_parent() {
 
 }
 
+/// @brief Evaluates the offspring incrementally against the cached parent.
+/// @details Each offspring only recomputes the nodes that depend on the genes 
+/// in which it differs from the parent. The recomputed node values are kept 
+/// per population slot to update the cache after selection.
+template<class E, class G, class F>
+void OnePlusLambda<E, G, F>::evaluate_offspring() {
+
+	std::shared_ptr<Individual<G, F>> individual;
+
+	if (this->screening) {
+		this->screen();
+	}
+
+	for (int i = 0; i < this->population->size(); i++) {
+		individual = this->population->get_individual(i);
+
+		if (individual->is_evaluated()) {
+			continue;
+		}
+
+		if (this->evaluation_pool != nullptr) {
+			this->evaluation_pool->submit(
+					[this, individual, i](BlackBoxProblem<E, G, F> &p) {
+						p.evaluate_incremental(individual, *this->node_cache,
+								this->overlays[i], this->cutoff_bound);
+					}, this->problem->evaluation_cost(individual));
+		} else {
+			this->problem->evaluate_incremental(individual, *this->node_cache,
+					this->overlays[i], this->cutoff_bound);
+		}
+	}
+
+	if (this->evaluation_pool != nullptr) {
+		this->evaluation_pool->wait();
+	}
+}
+
+/// @brief Moves the node cache to the selected parent.
+/// @details The cache is filled by a full pass in the first generation. Afterwards, 
+/// a selected offspring patches the cache with its recomputed node values. 
+/// Offspring without recomputed node values refill the cache by a full pass.
+template<class E, class G, class F>
+void OnePlusLambda<E, G, F>::update_node_cache() {
+	if (!this->node_cache->is_ready()
+			|| (this->parent_index != 0
+					&& !this->overlays[this->parent_index].complete)) {
+		this->problem->cache_individual(this->parent, *this->node_cache);
+	} else if (this->parent_index != 0) {
+		this->node_cache->patch(this->parent, this->overlays[this->parent_index]);
+	}
+}
+
 /// @brief Breed lambda offspring by mutation 
+/// @details The offspring slots are preallocated and overwritten in place. A selected
+/// offspring swaps its slot with the previous parent, so no individual is allocated.
 /// @param num_offspring number of offspring 
 template<class E, class G, class F>
 void OnePlusLambda<E, G, F>::breed(int num_offspring) {
@@ -147,17 +224,60 @@ void OnePlusLambda<E, G, F>::breed(int num_offspring) {
 			this->parent_index);
 
 	if (this->parent_index != 0) {
+		this->population->set_individual(this->population->get_individual(0),
+				this->parent_index);
 		this->population->set_individual(parent, 0);
 	}
 
-	std::shared_ptr<G[]> genome_parent = parent->get_genome();
+	// Offspring that cannot reach the fitness of the parent are pruned
+	if (this->racing) {
+		this->cutoff_bound = parent->get_fitness();
+	}
+
+	if (this->parallel_breeding) {
+		this->breed_streams(this->population->size() - 1,
+				[this](typename EvolutionaryAlgorithm<E, G, F>::Breeder &breeder,
+						int i) {
+					this->breed_offspring(*breeder.mutation, i + 1,
+							breeder.skipped_evaluations);
+				});
+		return;
+	}
 
 	for (int i = 1; i < this->population->size(); i++) {
-		std::shared_ptr<Individual<G, F>> offspring = std::make_shared<
-				Individual<G, F>>(parent);
-		this->mutation->mutate(offspring);
+		this->breed_offspring(*this->mutation, i, this->skipped_evaluations);
+	}
+}
+
+/// @brief Overwrites an offspring slot with a mutated copy of the parent in slot 0.
+/// @param p_mutation mutation that is used for the offspring
+/// @param index population index of the offspring
+/// @param skipped counter of the skipped evaluations
+template<class E, class G, class F>
+void OnePlusLambda<E, G, F>::breed_offspring(Mutation<G, F> &p_mutation,
+		int index, int &skipped) {
+
+	const std::shared_ptr<Individual<G, F>> &parent =
+			this->population->get_individual(0);
+	const std::shared_ptr<Individual<G, F>> &offspring =
+			this->population->get_individual(index);
+	offspring->copy_from(*parent);
+
+	MutationReport report = p_mutation.mutate(offspring);
+
+	// Offspring that only differ in inactive genes inherit the fitness 
+	// and active nodes of the parent
+	if (report.is_phenotype_changed() || !parent->is_evaluated()) {
 		offspring->set_evaluated(false);
-		this->population->set_individual(offspring, i);
+	} else {
+		skipped++;
+
+		if (this->incremental_evaluation) {
+			this->overlays[index].nodes.clear();
+			this->overlays[index].values.clear();
+			this->overlays[index].instances.clear();
+			this->overlays[index].complete = true;
+		}
 	}
 }
 
@@ -172,33 +292,77 @@ std::pair<int, F> OnePlusLambda<E, G, F>::evolve() {
 		this->parent_index = -1;
 	}
 
+	// A run resumed from a checkpoint starts with the parent in slot 0
+	bool resumed = this->generation_number > 1;
+
+	if (resumed) {
+		this->parent_index = 0;
+	}
+
+	if (this->incremental_evaluation) {
+		this->node_cache->reset();
+	}
+
+	this->cutoff_bound = this->fitness->worst_value();
+
 	while (this->generation_number <= this->max_generations && !this->is_ideal) {
 
-		this->evaluate();
+		this->open_selection_stream();
+
+		// The parent is re-evaluated on a new mini-batch and the node cache refilled
+		bool batch_changed = this->advance_batch();
+
+		if (batch_changed && this->incremental_evaluation) {
+			this->node_cache->reset();
+		}
+
+		if (this->incremental_evaluation && this->node_cache->is_ready()) {
+			this->evaluate_offspring();
+		} else {
+			this->evaluate();
+		}
+
+		// Offspring are compared with the fitness of the parent on the new batch
+		// or of the parent restored from the checkpoint
+		if (batch_changed || resumed) {
+			this->best_fitness = this->population->get_individual(0)->get_fitness();
+			resumed = false;
+		}
 
 		// Increase the number of fitness evaluations by the number
 		// that has been used in the evaluation procedure
 		this->fitness_evaluations += this->lambda;
 
+		if (this->racing) {
+			this->update_racing();
+		}
+
 		// Obtain parent with or without considering NGD
 		this->parent_index = this->select_parent();
 
 		this->parent = this->population->get_individual(this->parent_index);
+		this->best_individual = this->parent;
 
 		// Obtain best fitness from the sorted population
 		this->best_fitness = parent->get_fitness();
 
+		this->submit_snapshot(this->parent);
+
+		if (this->incremental_evaluation) {
+			this->update_node_cache();
+		}
+
 		this->report(this->generation_number);
 
 		// Check for ideal fitness
-		this->check_ideal(this->generation_number);
-
-		// Check for checkpoint modulo 
-		this->check_checkpoint();
+		this->check_ideal(this->generation_number, this->parent);
 
 		// Breed lambda offspring 
 		this->breed(lambda);
 
+		// Check for checkpoint modulo 
+		this->check_checkpoint();
+
 		// Reset parent index for the next generation
 		this->parent_index = 0;
 
@@ -0,0 +1,207 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: EvaluatorBenchmark.cpp
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+// Microbenchmark of the per-instance cost of the iterative evaluation. Compares the
+// former evaluation, which stored the node values in a std::map that was cleared for
+// each instance, with the dense node-value buffer of the Evaluator.
+//
+// Build: make evaluator-benchmark (in the build directory)
+// Usage: evaluator-benchmark [num_function_nodes] [num_instances]
+
+#include "../../parameters/Parameters.h"
+#include "../../random/Random.h"
+#include "../../representation/Species.h"
+#include "../../representation/Individual.h"
+#include "../../functions/BooleanFunctions.h"
+#include "../../evaluator/Evaluator.h"
+
+#include <array>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+typedef unsigned int E;
+typedef int G;
+typedef double F;
+
+/// @brief Evaluates an individual on one instance with a node-value map.
+/// @details Reference implementation of the map-based Evaluator::evaluate_iterative()
+/// before the dense buffer was introduced.
+static void evaluate_map(const std::shared_ptr<Individual<G, F>> &individual,
+		const std::shared_ptr<Species<G>> &species,
+		const std::shared_ptr<Functions<E>> &functions,
+		std::shared_ptr<Parameters> parameters, std::map<int, E> &node_value_map,
+		const std::vector<E> &inputs, std::vector<E> &outputs) {
+
+	int num_inputs = parameters->get_num_inputs();
+	int num_outputs = parameters->get_num_outputs();
+	int max_arity = parameters->get_max_arity();
+	int genome_size = parameters->get_genome_size();
+
+	const G *genome = individual->get_genome().get();
+
+	node_value_map.clear();
+
+	std::array<E, Functions<E>::MAX_ARITY> arguments;
+
+	for (int node_num : *individual->get_active_nodes()) {
+		int node_pos = species->position_from_node_number(node_num);
+		int function = genome[node_pos];
+
+		for (int i = 0; i < max_arity; i++) {
+			int node_arg = genome[node_pos + i + 1];
+
+			if (node_arg < num_inputs) {
+				arguments[i] = inputs.at(node_arg);
+			} else {
+				arguments[i] = node_value_map.at(node_arg);
+			}
+		}
+
+		node_value_map.insert( { node_num, functions->call_function(arguments.data(),
+				function) });
+	}
+
+	for (int i = 0; i < num_outputs; i++) {
+		int output_val = genome[genome_size - i - 1];
+
+		if (output_val < num_inputs) {
+			outputs.push_back(inputs.at(output_val));
+		} else {
+			outputs.push_back(node_value_map.at(output_val));
+		}
+	}
+}
+
+template<class T>
+static double measure(T run) {
+	auto start = std::chrono::steady_clock::now();
+	run();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char **argv) {
+
+	int num_nodes = argc > 1 ? std::atoi(argv[1]) : 4000;
+	int num_instances = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+	const int num_inputs = 16;
+	const int num_outputs = 8;
+
+	std::shared_ptr<Parameters> parameters = std::make_shared<Parameters>();
+	parameters->set_num_variables(num_inputs);
+	parameters->set_num_constants(0);
+	parameters->set_num_inputs(num_inputs);
+	parameters->set_num_outputs(num_outputs);
+	parameters->set_num_function_nodes(num_nodes);
+	parameters->set_levels_back(num_nodes);
+	parameters->set_num_functions(8);
+	parameters->set_max_arity(2);
+	parameters->set_genome_size();
+
+	std::shared_ptr<Random> random = std::make_shared<Random>(4242, parameters);
+	std::shared_ptr<Species<G>> species = std::make_shared<Species<G>>(random,
+			parameters);
+	std::shared_ptr<Functions<E>> functions = std::make_shared<FunctionsBoolean<E>>(
+			parameters);
+	std::shared_ptr<Evaluator<E, G, F>> evaluator = std::make_shared<
+			Evaluator<E, G, F>>(parameters, functions, species);
+
+	// Keep the individual with the most active nodes out of a few random genomes
+	std::shared_ptr<Individual<G, F>> individual;
+	for (int i = 0; i < 20; i++) {
+		std::shared_ptr<Individual<G, F>> candidate = std::make_shared<
+				Individual<G, F>>(random, parameters);
+		evaluator->decode_path(candidate);
+
+		if (individual == nullptr
+				|| candidate->get_active_nodes()->size()
+						> individual->get_active_nodes()->size()) {
+			individual = candidate;
+		}
+	}
+
+	std::vector<std::vector<E>> instances(num_instances, std::vector<E>(num_inputs));
+	for (std::vector<E> &instance : instances) {
+		for (E &input : instance) {
+			input = random->random_integer(0, 1 << 30);
+		}
+	}
+
+	std::map<int, E> node_value_map;
+	std::vector<E> outputs;
+	std::shared_ptr<std::vector<E>> inputs_ptr = std::make_shared<std::vector<E>>();
+	std::shared_ptr<std::vector<E>> outputs_ptr = std::make_shared<std::vector<E>>();
+
+	E checksum_map = 0;
+	E checksum_dense = 0;
+	E checksum_compiled = 0;
+
+	double time_map = measure([&] {
+		for (const std::vector<E> &instance : instances) {
+			outputs.clear();
+			evaluate_map(individual, species, functions, parameters,
+					node_value_map, instance, outputs);
+			for (E output : outputs) {
+				checksum_map ^= output;
+			}
+		}
+	});
+
+	double time_dense = measure([&] {
+		for (const std::vector<E> &instance : instances) {
+			*inputs_ptr = instance;
+			outputs_ptr->clear();
+			evaluator->evaluate_iterative(individual, inputs_ptr, outputs_ptr);
+			for (E output : *outputs_ptr) {
+				checksum_dense ^= output;
+			}
+		}
+	});
+
+	// The genome is decoded once and the program is run on all instances
+	double time_compiled = measure([&] {
+		const Program &program = evaluator->compile(individual);
+		for (const std::vector<E> &instance : instances) {
+			outputs.clear();
+			evaluator->execute(program, instance.data(), outputs);
+			for (E output : outputs) {
+				checksum_compiled ^= output;
+			}
+		}
+	});
+
+	std::cout << "Function nodes: " << num_nodes << " :: Active nodes: "
+			<< individual->get_active_nodes()->size() << " :: Instances: "
+			<< num_instances << std::endl;
+
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "std::map evaluation:      " << time_map * 1e9 / num_instances
+			<< " ns per instance" << std::endl;
+	std::cout << "Dense buffer evaluation:  " << time_dense * 1e9 / num_instances
+			<< " ns per instance (" << time_map / time_dense << "x)" << std::endl;
+	std::cout << "Compiled once, executed:  " << time_compiled * 1e9 / num_instances
+			<< " ns per instance (" << time_map / time_compiled << "x)" << std::endl;
+
+	if (checksum_map != checksum_dense || checksum_map != checksum_compiled) {
+		std::cerr << "Outputs of the evaluations differ!" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
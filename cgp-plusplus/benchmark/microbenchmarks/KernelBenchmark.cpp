@@ -0,0 +1,236 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: KernelBenchmark.cpp
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+// Microbenchmark of the function dispatch of compiled programs. Compares the
+// StaticKernel dispatch with the virtual Functions<E>::call_function() and
+// Functions<E>::call_function_block() dispatch for the Boolean and the mathematical
+// function set, per instance and per block of instances.
+//
+// Build: make kernel-benchmark (in the build directory)
+// Usage: kernel-benchmark [num_function_nodes] [num_instances]
+
+#include "../../parameters/Parameters.h"
+#include "../../random/Random.h"
+#include "../../representation/Species.h"
+#include "../../representation/Individual.h"
+#include "../../functions/BooleanFunctions.h"
+#include "../../functions/MathematicalFunctions.h"
+#include "../../evaluator/Evaluator.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+typedef int G;
+typedef double F;
+
+/// @brief Function set that differs from its base in type only.
+/// @details The Evaluator uses StaticKernel for the exact type of the function set,
+/// so derived sets are called through the virtual functions of Functions<E>.
+template<class FS>
+class VirtualFunctions: public FS {
+public:
+	using FS::FS;
+};
+
+/// @brief Accumulates the bit pattern of a value, so NaN results compare equal.
+template<class E>
+static void accumulate(std::uint64_t &checksum, E value) {
+	std::uint64_t bits = 0;
+	std::memcpy(&bits, &value, sizeof(E) < sizeof(bits) ? sizeof(E) : sizeof(bits));
+	checksum = (checksum ^ bits) * 1099511628211ULL;
+}
+
+template<class T>
+static double measure(T run) {
+	auto start = std::chrono::steady_clock::now();
+	run();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(end - start).count();
+}
+
+/// @brief Runs the program on all instances, one instance at a time.
+template<class E>
+static std::uint64_t run_scalar(Evaluator<E, G, F> &evaluator,
+		const Program &program, const std::vector<E> &instances,
+		int num_inputs) {
+
+	std::uint64_t checksum = 0;
+	std::vector<E> outputs;
+
+	for (std::size_t i = 0; i < instances.size(); i += num_inputs) {
+		outputs.clear();
+		evaluator.execute(program, instances.data() + i, outputs);
+		for (E output : outputs) {
+			accumulate(checksum, output);
+		}
+	}
+
+	return checksum;
+}
+
+/// @brief Runs the program on all instances in blocks of get_block_lanes() instances.
+template<class E>
+static std::uint64_t run_block(Evaluator<E, G, F> &evaluator,
+		const Program &program, const std::vector<E> &instances,
+		int num_inputs) {
+
+	std::uint64_t checksum = 0;
+
+	int num_instances = instances.size() / num_inputs;
+	int stride = evaluator.get_block_lanes();
+	E *registers = evaluator.get_block_registers();
+
+	for (int first = 0; first < num_instances; first += stride) {
+		int lanes = std::min(stride, num_instances - first);
+
+		for (int l = 0; l < lanes; l++) {
+			const E *instance = instances.data() + (first + l) * num_inputs;
+			for (int r = 0; r < num_inputs; r++) {
+				registers[r * stride + l] = instance[r];
+			}
+		}
+
+		evaluator.execute_block(program, lanes);
+
+		for (int l = 0; l < lanes; l++) {
+			for (int reg : program.outputs) {
+				accumulate(checksum, registers[reg * stride + l]);
+			}
+		}
+	}
+
+	return checksum;
+}
+
+/// @brief Compares both dispatches for a function set on a random individual.
+/// @return true if both dispatches compute the same outputs
+template<class E, class FS>
+static bool benchmark(const std::string &name, int num_functions, int num_nodes,
+		int num_instances) {
+
+	const int num_inputs = 16;
+	const int num_outputs = 8;
+
+	std::shared_ptr<Parameters> parameters = std::make_shared<Parameters>();
+	parameters->set_num_variables(num_inputs);
+	parameters->set_num_constants(0);
+	parameters->set_num_inputs(num_inputs);
+	parameters->set_num_outputs(num_outputs);
+	parameters->set_num_function_nodes(num_nodes);
+	parameters->set_levels_back(num_nodes);
+	parameters->set_num_functions(num_functions);
+	parameters->set_max_arity(FS::ARITY);
+	parameters->set_genome_size();
+
+	std::shared_ptr<Random> random = std::make_shared<Random>(4242, parameters);
+	std::shared_ptr<Species<G>> species = std::make_shared<Species<G>>(random,
+			parameters);
+
+	Evaluator<E, G, F> static_evaluator(parameters,
+			std::make_shared<FS>(parameters), species);
+	Evaluator<E, G, F> virtual_evaluator(parameters,
+			std::make_shared<VirtualFunctions<FS>>(parameters), species);
+
+	// Keep the individual with the most active nodes out of a few random genomes
+	std::shared_ptr<Individual<G, F>> individual;
+	for (int i = 0; i < 20; i++) {
+		std::shared_ptr<Individual<G, F>> candidate = std::make_shared<
+				Individual<G, F>>(random, parameters);
+		static_evaluator.decode_path(candidate);
+
+		if (individual == nullptr
+				|| candidate->get_active_nodes()->size()
+						> individual->get_active_nodes()->size()) {
+			individual = candidate;
+		}
+	}
+
+	std::vector<E> instances(num_instances * num_inputs);
+	for (E &input : instances) {
+		if (std::is_floating_point<E>::value) {
+			input = random->random_float(-1.0, 1.0);
+		} else {
+			input = random->random_integer(0, 1 << 30);
+		}
+	}
+
+	const Program &static_program = static_evaluator.compile(individual);
+	const Program &virtual_program = virtual_evaluator.compile(individual);
+
+	std::uint64_t checksums[4];
+
+	double time_virtual = measure([&] {
+		checksums[0] = run_scalar(virtual_evaluator, virtual_program, instances,
+				num_inputs);
+	});
+	double time_static = measure([&] {
+		checksums[1] = run_scalar(static_evaluator, static_program, instances,
+				num_inputs);
+	});
+	double time_virtual_block = measure([&] {
+		checksums[2] = run_block(virtual_evaluator, virtual_program, instances,
+				num_inputs);
+	});
+	double time_static_block = measure([&] {
+		checksums[3] = run_block(static_evaluator, static_program, instances,
+				num_inputs);
+	});
+
+	double instructions = double(static_program.size()) * num_instances;
+
+	std::cout << name << " :: Instructions: " << static_program.size()
+			<< " :: Instances: " << num_instances << " :: Block lanes: "
+			<< static_evaluator.get_block_lanes() << std::endl;
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "  Functions<E>::call_function:       "
+			<< time_virtual * 1e9 / instructions << " ns per instruction" << std::endl;
+	std::cout << "  StaticKernel::run:                 "
+			<< time_static * 1e9 / instructions << " ns per instruction ("
+			<< time_virtual / time_static << "x)" << std::endl;
+	std::cout << "  Functions<E>::call_function_block: "
+			<< time_virtual_block * 1e9 / instructions << " ns per instruction"
+			<< std::endl;
+	std::cout << "  StaticKernel::run_block:           "
+			<< time_static_block * 1e9 / instructions << " ns per instruction ("
+			<< time_virtual_block / time_static_block << "x)" << std::endl;
+
+	if (checksums[0] != checksums[1] || checksums[2] != checksums[3]
+			|| checksums[0] != checksums[2]) {
+		std::cerr << name << ": Outputs of the dispatches differ!" << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char **argv) {
+
+	int num_nodes = argc > 1 ? std::atoi(argv[1]) : 2000;
+	int num_instances = argc > 2 ? std::atoi(argv[2]) : 50000;
+
+	bool equal = benchmark<unsigned int, FunctionsBoolean<unsigned int>>(
+			"Boolean functions (unsigned int)", 8, num_nodes, num_instances);
+	equal &= benchmark<float, FunctionsMathematical<float>>(
+			"Mathematical functions (float)", 4, num_nodes, num_instances);
+
+	return equal ? 0 : 1;
+}
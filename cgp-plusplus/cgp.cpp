@@ -60,6 +60,7 @@ void usage(const char *self) {
 	std::cout << "-2 <value>          max duplication depth" << std::endl;
 	std::cout << "-3 <value>          inversion rate" << std::endl;
 	std::cout << "-4 <value>          max inversion depth" << std::endl;
+	std::cout << "-t <file>           test data file (MNIST)" << std::endl;
 	exit(1);
 }
 
@@ -77,6 +78,7 @@ int main(int argcc, char **argvv, char **envp) {
 	std::string param_file = argvv[2];
 
 	std::string checkpoint_file;
+	std::string test_file;
 	std::string s;
 
 	int num_nodes = -1;
@@ -140,7 +142,7 @@ int main(int argcc, char **argvv, char **envp) {
 	// ---------------------------------------------------------------------------------------
 	char opt;
 	while ((opt = getopt(argcc, argvv,
-			"a:n:v:z:c:i:o:f:r:m:p:l:b:e:g:j:s:1:2:3:4")) != -1) {
+			"a:n:v:z:c:i:o:f:r:m:p:l:b:e:g:j:s:1:2:3:4:t:")) != -1) {
 		switch (opt) {
 
 		case 'a':
@@ -227,6 +229,10 @@ int main(int argcc, char **argvv, char **envp) {
 			max_inversion_depth = atoi(optarg);
 			break;
 
+		case 't':
+			test_file = optarg;
+			break;
+
 		default:
 			usage(*argvv);
 			exit(1);
@@ -276,7 +282,7 @@ int main(int argcc, char **argvv, char **envp) {
                             FITNESS_TYPE>>(data_file);
         } else {
             throw std::invalid_argument(
-                    "Evaluation type (must be unsigned int) is not supported for MNIST Logic!");
+                    "Evaluation type (must be unsigned int or unsigned long) is not supported for MNIST Logic!");
         }
     }
 
@@ -302,6 +308,10 @@ int main(int argcc, char **argvv, char **envp) {
 	initializer->init_composite();
 	initializer->init_erc();
 	initializer->init_problem();
+
+	initializer->set_test_file(test_file);
+	initializer->init_validator();
+
 	initializer->init_checkpoint();
 	initializer->init_algorithm();
 
@@ -40,7 +40,8 @@ public:
 	Checkpoint(std::shared_ptr<Parameters> p_parameters);
 	virtual ~Checkpoint() = default;
 	void write(std::shared_ptr<AbstractPopulation<G, F>> population,
-			std::shared_ptr<std::vector<E>> constants, int generation_number);
+			std::shared_ptr<std::vector<E>> constants,
+			std::shared_ptr<Random> random, int generation_number);
 	int load(std::shared_ptr<AbstractPopulation<G, F>> population,
 			std::shared_ptr<std::vector<E>> constants,
 			std::shared_ptr<Random> random, std::string &checkpoint_file_path);
@@ -82,14 +83,16 @@ void Checkpoint<E, G, F>::create_dir() {
 
 /// @brief Writes the data to a file.
 /// @details Creates the file name based on the generation number.The checkpoint data includes the generation number, 
-/// global seed, genomes of each individual in the population, and constants.
+/// global seed, epoch of the random streams, genomes of each individual in the population, and constants.
 /// @param population 
 /// @param constants 
+/// @param random random generator whose stream epoch is stored
 /// @param generation_number 
 template<class E, class G, class F>
 void Checkpoint<E, G, F>::write(
 		std::shared_ptr<AbstractPopulation<G, F>> population,
-		std::shared_ptr<std::vector<E>> constants, int generation_number) {
+		std::shared_ptr<std::vector<E>> constants,
+		std::shared_ptr<Random> random, int generation_number) {
 	std::stringstream ss;
 	std::unique_ptr<std::ofstream> ofs;
 
@@ -101,6 +104,7 @@ void Checkpoint<E, G, F>::write(
 	ss.str("");
 	ss << "generation_number " << generation_number << std::endl;
 	ss << "global_seed " << this->parameters->get_global_seed() << std::endl;
+	ss << "stream_epoch " << random->get_stream_epoch() << std::endl;
 
 	// Write the constants
 	for (int i = 0; i < this->parameters->get_population_size(); i++) {
@@ -136,6 +140,7 @@ int Checkpoint<E, G, F>::load(
 	std::string value;
 
 	double global_seed;
+	long long stream_epoch = 0;
 	int generation_number;
 	double constant;
 
@@ -150,6 +155,8 @@ int Checkpoint<E, G, F>::load(
 				generation_number = std::stoi(value);
 			} else if (parameter == "global_seed") {
 				global_seed = std::stod(value);
+			} else if (parameter == "stream_epoch") {
+				stream_epoch = std::stoll(value);
 			} else if (parameter == "genome") {
 				std::vector<std::string> genome = this->split_genome(value);
 				genomes->push_back(genome);
@@ -169,6 +176,7 @@ int Checkpoint<E, G, F>::load(
 	}
 
 	random->set_seed(global_seed);
+	random->set_stream_epoch(stream_epoch);
 	population->init_from_checkpoint(genomes);
 
 	return generation_number;
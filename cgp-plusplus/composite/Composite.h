@@ -26,6 +26,7 @@
 #include "../mutation/MutationPipeline.h"
 #include "../recombination/Recombination.h"
 #include "../problems/BlackBoxProblem.h"
+#include "../evaluator/TestValidator.h"
 #include "../benchmark/BenchmarkFileReader.h"
 
  /// @brief A composite class that represents a combination of various components used 
@@ -57,6 +58,8 @@ private:
 
 	std::shared_ptr<Checkpoint<E, G, F>> checkpoint;
 
+	// Validator for held-out test data, nullptr if no test file has been passed
+	std::shared_ptr<TestValidator<E, G, F>> validator;
 
 public:
 	Composite(std::shared_ptr<Parameters> p_parameters, std::shared_ptr<Functions<E>> p_functions);
@@ -91,6 +94,8 @@ public:
 	void set_constants(const std::shared_ptr<std::vector<E> > &p_constants);
 	const std::shared_ptr<Checkpoint<E, G, F> >& get_checkpoint() const;
 	void set_checkpoint(const std::shared_ptr<Checkpoint<E, G, F> > &checkpoint);
+	const std::shared_ptr<TestValidator<E, G, F> >& get_validator() const;
+	void set_validator(const std::shared_ptr<TestValidator<E, G, F> > &p_validator);
 };
 
 template<class E, class G, class F>
@@ -308,6 +313,17 @@ void Composite<E, G, F>::set_checkpoint(
 	this->checkpoint = p_checkpoint;
 }
 
+template<class E, class G, class F>
+const std::shared_ptr<TestValidator<E, G, F> >& Composite<E, G, F>::get_validator() const {
+	return this->validator;
+}
+
+template<class E, class G, class F>
+void Composite<E, G, F>::set_validator(
+		const std::shared_ptr<TestValidator<E, G, F> > &p_validator) {
+	this->validator = p_validator;
+}
+
 template<class E, class G, class F>
 void Composite<E, G, F>::set_constants(const std::shared_ptr<std::vector<E> > &p_constants) {
 	this->constants = p_constants;
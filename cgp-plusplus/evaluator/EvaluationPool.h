@@ -0,0 +1,353 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: EvaluationPool.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef EVALUATOR_EVALUATIONPOOL_H_
+#define EVALUATOR_EVALUATIONPOOL_H_
+
+#include "../problems/BlackBoxProblem.h"
+
+#include <stdexcept>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <cstddef>
+
+/// @brief Persistent pool of evaluation threads with work stealing.
+/// @details The worker threads are created once and live until the pool is destroyed.
+/// Each worker owns a clone of the problem (and therefore its own evaluator), while
+/// the problem data is shared read-only between the clones. Each worker has its own
+/// task queue. A task is queued at the worker with the lowest queued cost, so tasks
+/// submitted in descending order of their cost are balanced like a longest-processing-
+/// time schedule. Workers take tasks from the front of their own queue and steal from
+/// the back of the other queues once their own queue has run empty, which compensates
+/// for inaccurate cost hints. Tasks receive the problem of the worker that executes them.
+/// @tparam E Evaluation type
+/// @tparam G Genome type
+/// @tparam F Fitness type
+template<class E, class G, class F>
+class EvaluationPool {
+public:
+	using Task = std::function<void(BlackBoxProblem<E, G, F>&)>;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Job {
+		Task task;
+		double cost;
+	};
+
+	struct Queue {
+		std::deque<Job> jobs;
+		std::mutex mutex;
+
+		// Cost of the queued jobs, guarded by the queue_mutex of the pool
+		double load = 0;
+
+		// Written by the owning worker only, read while the pool is idle
+		Clock::duration busy = Clock::duration::zero();
+		long long num_steals = 0;
+	};
+
+	std::vector<std::thread> workers;
+	std::vector<std::unique_ptr<BlackBoxProblem<E, G, F>>> problems;
+	std::vector<std::unique_ptr<Queue>> queues;
+
+	std::mutex queue_mutex;
+	std::condition_variable task_available;
+	std::condition_variable tasks_finished;
+
+	int num_queued;
+	int num_unfinished;
+	bool stopping;
+
+	// Time in which tasks were pending, i.e. from the first submit to the end of wait()
+	Clock::time_point phase_start;
+	Clock::duration elapsed;
+
+	void work(int worker);
+	bool take(int worker, Job &job);
+	void enqueue(Task &&task, double cost);
+
+public:
+	EvaluationPool(std::shared_ptr<BlackBoxProblem<E, G, F>> p_problem,
+			int p_num_threads);
+	~EvaluationPool();
+
+	EvaluationPool(const EvaluationPool&) = delete;
+	EvaluationPool& operator=(const EvaluationPool&) = delete;
+
+	void submit(Task task, double cost = 1.0);
+	void submit_all(std::vector<Task> &p_tasks, const std::vector<double> &costs);
+	void wait();
+	int size() const;
+
+	void reset_statistics();
+	std::vector<double> get_utilization() const;
+	long long get_num_steals() const;
+};
+
+/// @brief Constructor that clones the problem for each worker and starts the threads.
+/// @param p_problem problem that is cloned for each worker
+/// @param p_num_threads number of worker threads
+template<class E, class G, class F>
+EvaluationPool<E, G, F>::EvaluationPool(
+		std::shared_ptr<BlackBoxProblem<E, G, F>> p_problem,
+		int p_num_threads) {
+
+	if (p_problem == nullptr) {
+		throw std::invalid_argument(
+				"Nullpointer exception in evaluation pool class!");
+	}
+
+	if (p_num_threads < 1) {
+		throw std::invalid_argument(
+				"Evaluation pool requires at least one thread!");
+	}
+
+	num_queued = 0;
+	num_unfinished = 0;
+	stopping = false;
+	elapsed = Clock::duration::zero();
+
+	for (int i = 0; i < p_num_threads; i++) {
+		problems.emplace_back(p_problem->clone());
+		queues.emplace_back(std::make_unique<Queue>());
+	}
+
+	for (int i = 0; i < p_num_threads; i++) {
+		workers.emplace_back(&EvaluationPool<E, G, F>::work, this, i);
+	}
+}
+
+/// @brief Stops the workers after the queued tasks have been processed and joins them.
+template<class E, class G, class F>
+EvaluationPool<E, G, F>::~EvaluationPool() {
+	{
+		std::lock_guard<std::mutex> lock(this->queue_mutex);
+		this->stopping = true;
+	}
+
+	this->task_available.notify_all();
+
+	for (auto &worker : this->workers) {
+		worker.join();
+	}
+}
+
+/// @brief Takes the next job from the own queue or steals one from another worker.
+/// @param worker index of the worker
+/// @param job taken job
+/// @return true if a job has been taken
+template<class E, class G, class F>
+bool EvaluationPool<E, G, F>::take(int worker, Job &job) {
+
+	int num_workers = this->queues.size();
+
+	for (int k = 0; k < num_workers; k++) {
+		Queue &queue = *this->queues[(worker + k) % num_workers];
+
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (queue.jobs.empty()) {
+				continue;
+			}
+
+			// The own queue is processed in submission order, thieves take the last job
+			if (k == 0) {
+				job = std::move(queue.jobs.front());
+				queue.jobs.pop_front();
+			} else {
+				job = std::move(queue.jobs.back());
+				queue.jobs.pop_back();
+				this->queues[worker]->num_steals++;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(this->queue_mutex);
+		this->num_queued--;
+		queue.load -= job.cost;
+		return true;
+	}
+
+	return false;
+}
+
+/// @brief Worker loop that executes queued tasks on the problem clone of the worker.
+/// @param worker index of the worker
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::work(int worker) {
+
+	BlackBoxProblem<E, G, F> &problem = *this->problems[worker];
+	Queue &own = *this->queues[worker];
+
+	while (true) {
+		Job job;
+
+		if (!this->take(worker, job)) {
+			std::unique_lock<std::mutex> lock(this->queue_mutex);
+			this->task_available.wait(lock, [this] {
+				return this->stopping || this->num_queued > 0;
+			});
+
+			if (this->num_queued == 0) {
+				return;
+			}
+
+			continue;
+		}
+
+		Clock::time_point start = Clock::now();
+		job.task(problem);
+		own.busy += Clock::now() - start;
+
+		{
+			std::lock_guard<std::mutex> lock(this->queue_mutex);
+			this->num_unfinished--;
+		}
+
+		this->tasks_finished.notify_all();
+	}
+}
+
+/// @brief Queues a job at the worker with the lowest queued cost.
+/// @details Must be called with the queue_mutex locked.
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::enqueue(Task &&task, double cost) {
+
+	if (this->num_unfinished == 0) {
+		this->phase_start = Clock::now();
+	}
+
+	Queue *target = this->queues[0].get();
+	for (const std::unique_ptr<Queue> &queue : this->queues) {
+		if (queue->load < target->load) {
+			target = queue.get();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> queue_lock(target->mutex);
+		target->jobs.push_back(Job { std::move(task), cost });
+	}
+
+	target->load += cost;
+	this->num_queued++;
+	this->num_unfinished++;
+}
+
+/// @brief Queues a task at the worker with the lowest queued cost.
+/// @param task task that receives the problem of the executing worker
+/// @param cost estimated cost of the task, only its relation to other costs matters
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::submit(Task task, double cost) {
+	{
+		std::lock_guard<std::mutex> lock(this->queue_mutex);
+		this->enqueue(std::move(task), cost);
+	}
+
+	this->task_available.notify_one();
+}
+
+/// @brief Queues several tasks at once and wakes up the workers once.
+/// @details Tasks should be passed in descending order of their cost.
+/// @param p_tasks tasks that receive the problem of the executing worker, moved out
+/// @param costs estimated costs of the tasks
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::submit_all(std::vector<Task> &p_tasks,
+		const std::vector<double> &costs) {
+
+	if (p_tasks.size() != costs.size()) {
+		throw std::invalid_argument(
+				"Number of tasks and costs must be equal!");
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->queue_mutex);
+		for (std::size_t i = 0; i < p_tasks.size(); i++) {
+			this->enqueue(std::move(p_tasks[i]), costs[i]);
+		}
+	}
+
+	this->task_available.notify_all();
+}
+
+/// @brief Blocks until all submitted tasks have been executed.
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::wait() {
+	std::unique_lock<std::mutex> lock(this->queue_mutex);
+	this->tasks_finished.wait(lock, [this] {
+		return this->num_unfinished == 0;
+	});
+
+	if (this->phase_start != Clock::time_point()) {
+		this->elapsed += Clock::now() - this->phase_start;
+		this->phase_start = Clock::time_point();
+	}
+}
+
+/// @brief Returns the number of worker threads.
+template<class E, class G, class F>
+int EvaluationPool<E, G, F>::size() const {
+	return this->workers.size();
+}
+
+/// @brief Resets the busy times and steal counts of the workers.
+/// @details Must only be called while the pool is idle (see wait()).
+template<class E, class G, class F>
+void EvaluationPool<E, G, F>::reset_statistics() {
+	std::lock_guard<std::mutex> lock(this->queue_mutex);
+
+	for (const std::unique_ptr<Queue> &queue : this->queues) {
+		queue->busy = Clock::duration::zero();
+		queue->num_steals = 0;
+	}
+
+	this->elapsed = Clock::duration::zero();
+}
+
+/// @brief Returns the utilization of each worker since the last reset.
+/// @details The utilization is the time a worker has spent in tasks divided by the
+/// time in which tasks were pending. Must only be called while the pool is idle.
+/// @return fraction of the pending time for each worker, 0 if no task has been run
+template<class E, class G, class F>
+std::vector<double> EvaluationPool<E, G, F>::get_utilization() const {
+	std::vector<double> utilization;
+	double pending = std::chrono::duration<double>(this->elapsed).count();
+
+	for (const std::unique_ptr<Queue> &queue : this->queues) {
+		double busy = std::chrono::duration<double>(queue->busy).count();
+		utilization.push_back(pending > 0 ? busy / pending : 0.0);
+	}
+
+	return utilization;
+}
+
+/// @brief Returns the number of tasks that have been stolen since the last reset.
+template<class E, class G, class F>
+long long EvaluationPool<E, G, F>::get_num_steals() const {
+	long long num_steals = 0;
+
+	for (const std::unique_ptr<Queue> &queue : this->queues) {
+		num_steals += queue->num_steals;
+	}
+
+	return num_steals;
+}
+
+#endif /* EVALUATOR_EVALUATIONPOOL_H_ */
@@ -16,8 +16,13 @@
 #include "../parameters/Parameters.h"
 #include "../functions/Functions.h"
 #include "../representation/Species.h"
+#include "Program.h"
+#include "NodeCache.h"
+#include "StaticKernel.h"
 
 #include <map>
+#include <array>
+#include <vector>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
@@ -26,6 +31,8 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <cstdint>
+#include <typeinfo>
 
 /// @brief Represents the evaluator for CGP (Cartesian Genetic Programming). 
 /// @details Responsible for decoding and evaluating the encoded chromosomes. Provides functions for recursive and iterative evaluation
@@ -47,45 +54,95 @@ private:
 	std::shared_ptr<Species<G>> species;
 
 	std::map<int, E> node_value_map;
-	std::map<int, int> node_number_map;
 	std::map<int, string> expression_map;
 
+	// One bit per node number, set for the nodes reached by decode_path()
+	std::vector<std::uint64_t> active_bits;
+
+	// Register file of the compiled program (inputs followed by the active nodes)
+	std::vector<E> node_values;
+
+	// Register file for blocks of instances, register r of lane l is located at
+	// block_values[r * block_lanes + l]
+	std::vector<E> block_values;
+	int block_lanes;
+
+	// Register index of each node number, used while compiling
+	std::vector<int> node_registers;
+
+	// Program compiled from the most recent individual
+	Program program;
+
+	// Canonical phenotype of the most recently decoded individual
+	std::vector<int> phenotype;
+
+	// Incremental program and scratch flags used by compile_incremental()
+	Program incremental_program;
+	std::vector<char> dirty;
+	std::vector<int> load_registers;
+
+	// Set if the function set can be called through StaticKernel
+	bool static_dispatch;
+
+	void run(const Program &program, E *registers);
+	void run_block(const Program &program, E *registers, int lanes);
+	int arity_of(int function);
+
 	bool evaluate_expression = true;
 
-	int gene_at(std::shared_ptr<G[]> genome, int position);
+	int gene_at(const G *genome, int position);
+
+	static std::uint64_t hash_combine(std::uint64_t hash, std::uint64_t value);
+	std::uint64_t hash_phenotype(const G *genome,
+			const std::shared_ptr<std::vector<int>> &active_nodes);
 
 public:
+	// Number of instances evaluated together, one 512-bit vector per register
+	static constexpr int BLOCK_LANES = sizeof(E) < 64 ? 64 / sizeof(E) : 1;
+
 	Evaluator(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Functions<E>> p_functions,
 			std::shared_ptr<Species<G>> p_species);
+	Evaluator(const Evaluator &evaluator);
 	virtual ~Evaluator() = default;
-	void evaluate_recursive(std::shared_ptr<Individual<G, F>> individual,
-			std::shared_ptr<std::vector<E>> inputs,
-			std::shared_ptr<std::vector<E>> outputs);
+	void evaluate_recursive(const std::shared_ptr<Individual<G, F>> &individual,
+			const std::shared_ptr<std::vector<E>> &inputs,
+			const std::shared_ptr<std::vector<E>> &outputs);
 	std::pair<E, std::string> evaluate_node(
-			std::shared_ptr<std::vector<E>> inputs,
+			const std::shared_ptr<std::vector<E>> &inputs,
 			std::stringstream *expression_stream,
-			std::shared_ptr<std::vector<int>> active_nodes,
-			std::shared_ptr<G[]> genome, int node_num, int num_inputs);
+			const std::shared_ptr<std::vector<int>> &active_nodes,
+			const G *genome, int node_num, int num_inputs);
+
+	void evaluate_iterative(const std::shared_ptr<Individual<G, F>> &individual,
+			const std::shared_ptr<std::vector<E>> &inputs,
+			const std::shared_ptr<std::vector<E>> &outputs);
 
-	void evaluate_iterative(std::shared_ptr<Individual<G, F>> individual,
-			std::shared_ptr<std::vector<E>> inputs,
-			std::shared_ptr<std::vector<E>> outputs);
+	const Program& compile(const std::shared_ptr<Individual<G, F>> &individual);
+	void execute(const Program &program, const E *inputs, std::vector<E> &outputs);
 
-	void decode_path(std::shared_ptr<Individual<G, F>> individual);
-	void visit_node(std::shared_ptr<G[]> genome,
-			std::shared_ptr<std::vector<int>> active_nodes, int node_num,
-			int num_inputs);
+	const Program& compile_incremental(
+			const std::shared_ptr<Individual<G, F>> &individual,
+			const NodeCache<E, G, F> &cache);
+	const E* get_registers() const;
 
-	void decode_expression(std::shared_ptr<G[]> genome,
+	E* get_block_registers();
+	int get_block_lanes() const;
+	void set_block_lanes(int p_block_lanes);
+	void execute_block(const Program &program, int lanes);
+
+	void decode_path(const std::shared_ptr<Individual<G, F>> &individual);
+	const std::vector<int>& get_phenotype() const;
+
+	void decode_expression(const G *genome,
 			std::shared_ptr<std::string[]> expressions);
 
-	std::string decode_node_expression(std::shared_ptr<G[]> genome,
+	std::string decode_node_expression(const G *genome,
 			std::stringstream *expression, int node_num, int num_inputs);
 
 	void decode(int genome[]);
 
-	void determine_active_nodes(std::shared_ptr<Individual<G, F>> individual);
+	void determine_active_nodes(const std::shared_ptr<Individual<G, F>> &individual);
 
 	void clear_maps();
 };
@@ -110,6 +167,54 @@ Evaluator<E, G, F>::Evaluator(std::shared_ptr<Parameters> p_parameters,
 	max_arity = parameters->get_max_arity();
 
 	evaluate_expression = parameters->is_evaluate_expression();
+
+	node_values.resize(num_inputs + parameters->get_num_function_nodes());
+	block_lanes = BLOCK_LANES;
+	block_values.resize(node_values.size() * block_lanes);
+	node_registers.resize(num_inputs + parameters->get_num_function_nodes());
+	active_bits.resize((node_registers.size() + 63) / 64);
+	dirty.resize(num_inputs + parameters->get_num_function_nodes());
+	load_registers.resize(num_inputs + parameters->get_num_function_nodes(), -1);
+
+	program.num_inputs = num_inputs;
+	program.max_arity = max_arity;
+	incremental_program.max_arity = max_arity;
+
+	// Derived function sets may override the functions, so only the exact type qualifies
+	static_dispatch = typeid(*functions) == typeid(StaticFunctions<E>)
+			&& max_arity == StaticFunctions<E>::ARITY;
+}
+
+/// @brief Copy constructor for per-thread evaluators
+/// @details Shares the configuration (parameters, functions and species) but not the
+/// internal maps, so each copy provides its own scratch space and can be used
+/// concurrently with the original.
+/// @param evaluator evaluator instance to copy
+template<class E, class G, class F>
+Evaluator<E, G, F>::Evaluator(const Evaluator &evaluator) {
+	parameters = evaluator.parameters;
+	functions = evaluator.functions;
+	species = evaluator.species;
+
+	num_outputs = evaluator.num_outputs;
+	num_inputs = evaluator.num_inputs;
+	genome_size = evaluator.genome_size;
+	max_arity = evaluator.max_arity;
+
+	evaluate_expression = evaluator.evaluate_expression;
+	static_dispatch = evaluator.static_dispatch;
+
+	node_values.resize(evaluator.node_values.size());
+	block_lanes = evaluator.block_lanes;
+	block_values.resize(evaluator.block_values.size());
+	node_registers.resize(evaluator.node_registers.size());
+	active_bits.resize(evaluator.active_bits.size());
+	dirty.resize(evaluator.dirty.size());
+	load_registers.resize(evaluator.load_registers.size(), -1);
+
+	program.num_inputs = num_inputs;
+	program.max_arity = max_arity;
+	incremental_program.max_arity = max_arity;
 }
 
 /// @brief Returns the gene at the specified position in the genome.
@@ -122,7 +227,7 @@ Evaluator<E, G, F>::Evaluator(std::shared_ptr<Parameters> p_parameters,
 /// @param position Position of the gene in the genome.
 /// @return Gene value at the specified position
 template<class E, class G, class F>
-int Evaluator<E, G, F>::gene_at(std::shared_ptr<G[]> genome, int position) {
+int Evaluator<E, G, F>::gene_at(const G *genome, int position) {
 	if (this->species->is_real_valued()) {
 		float gene_value = genome[position];
 		return this->species->interpret_float(gene_value, position);
@@ -136,7 +241,6 @@ template<class E, class G, class F>
 void Evaluator<E, G, F>::clear_maps() {
 	this->node_value_map.clear();
 	this->expression_map.clear();
-	this->node_number_map.clear();
 }
 
 /// @brief Determines the active nodes of an individual.
@@ -146,14 +250,14 @@ void Evaluator<E, G, F>::clear_maps() {
 /// @param individual Poiner to the individual instance 
 template<class E, class G, class F>
 void Evaluator<E, G, F>::determine_active_nodes(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	// Get the list of active nodes in the individual
 	std::shared_ptr<std::vector<int>> active_nodes =
 			individual->get_active_nodes();
 
 	// Get the genome of the individual
-	std::shared_ptr<G[]> genome = individual->get_genome();
+	const G *genome = individual->get_genome().get();
 
 	// Create a map to store the node number and its position in the genome
 	std::map<int, int> node_number_map;
@@ -195,10 +299,10 @@ void Evaluator<E, G, F>::determine_active_nodes(
 /// @return  A pair of the evaluated value and the expression.
 template<class E, class G, class F>
 std::pair<E, std::string> Evaluator<E, G, F>::evaluate_node(
-		std::shared_ptr<std::vector<E>> inputs,
+		const std::shared_ptr<std::vector<E>> &inputs,
 		std::stringstream *expression_stream,
-		std::shared_ptr<std::vector<int>> active_nodes,
-		std::shared_ptr<G[]> genome, int node_num, int num_inputs) {
+		const std::shared_ptr<std::vector<int>> &active_nodes,
+		const G *genome, int node_num, int num_inputs) {
 
 	// If the node has already been evaluated, retrieve the value and expression
 	if (this->node_value_map.count(node_num) == 1) {
@@ -242,11 +346,11 @@ std::pair<E, std::string> Evaluator<E, G, F>::evaluate_node(
 	int connection_gene;
 	int position = this->species->position_from_node_number(node_num);
 	int function = gene_at(genome, position);
-	int num_arguments = this->functions->arity_of(function);
+	int num_arguments = this->arity_of(function);
 	int max_arity = parameters->get_max_arity();
 	std::stringstream node_expression;
 
-	E arguments[max_arity];
+	std::array<E, Functions<E>::MAX_ARITY> arguments;
 
 	// Evaluate the expression of the node if desired and append it to the string stream
 	if (this->evaluate_expression) {
@@ -288,7 +392,7 @@ std::pair<E, std::string> Evaluator<E, G, F>::evaluate_node(
 	}
 
 	// Call the function with the evaluated arguments
-	E result = functions->call_function(arguments, function);
+	E result = functions->call_function(arguments.data(), function);
 	node_value_map.insert( { node_num, result });
 
 	std::pair<E, std::string> pair { result, node_expression.str() };
@@ -303,9 +407,9 @@ std::pair<E, std::string> Evaluator<E, G, F>::evaluate_node(
 /// @param outputs outputs vector to store evalation results
 template<class E, class G, class F>
 void Evaluator<E, G, F>::evaluate_recursive(
-		std::shared_ptr<Individual<G, F>> individual,
-		std::shared_ptr<std::vector<E>> inputs,
-		std::shared_ptr<std::vector<E>> outputs) {
+		const std::shared_ptr<Individual<G, F>> &individual,
+		const std::shared_ptr<std::vector<E>> &inputs,
+		const std::shared_ptr<std::vector<E>> &outputs) {
 
 	// Reset the internal maps before evaluation
 	this->clear_maps();
@@ -313,7 +417,7 @@ void Evaluator<E, G, F>::evaluate_recursive(
 	// Obtain the active nodes and genome from the individual object.
 	std::shared_ptr<std::vector<int>> active_nodes =
 			individual->get_active_nodes();
-	std::shared_ptr<G[]> genome = individual->get_genome();
+	const G *genome = individual->get_genome().get();
 
 	// A string stream object is instantiated to store expressions during evaluation
 	std::stringstream expression_stream;
@@ -354,147 +458,498 @@ void Evaluator<E, G, F>::evaluate_recursive(
 
 
 /// @brief Iterative evaluation of a CGP individual.
-/// @details Iterates over the active nodes, evaluates and stores the immediate results
+/// @details Compiles the active nodes of the individual and executes the program 
+/// for the given inputs. When an individual is evaluated on several instances, 
+/// compile() should be called once and execute() for each instance. 
 /// @param individual CGP individual to evaluate
 /// @param inputs input values used for evaluation
 /// @param outputs outputs vector to store evalation results
 template<class E, class G, class F>
 void Evaluator<E, G, F>::evaluate_iterative(
-		std::shared_ptr<Individual<G, F>> individual,
-		std::shared_ptr<std::vector<E>> inputs,
-		std::shared_ptr<std::vector<E>> outputs) {
+		const std::shared_ptr<Individual<G, F>> &individual,
+		const std::shared_ptr<std::vector<E>> &inputs,
+		const std::shared_ptr<std::vector<E>> &outputs) {
+	this->execute(this->compile(individual), inputs->data(), *outputs);
+}
+
+/// @brief Compiles the active graph of an individual into a straight-line program.
+/// @details Decodes function and connection genes of the active nodes once, so that 
+/// the evaluation of the instances does not have to access the genome. The active 
+/// nodes are mapped to compact registers in ascending order. 
+/// The program is owned by the evaluator and valid until the next compilation.
+/// @param individual decoded CGP individual
+/// @return reference to the compiled program
+template<class E, class G, class F>
+const Program& Evaluator<E, G, F>::compile(
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	std::shared_ptr<std::vector<int>> active_nodes =
 			individual->get_active_nodes();
 
-	std::shared_ptr<G[]> genome = individual->get_genome();
-
-	this->clear_maps();
+	const G *genome = individual->get_genome().get();
 
-	int output_val;
-	int output_pos;
 	int node_num;
 	int node_pos;
 	int node_arg;
-	int function;
+	int output_val;
+	int output_pos;
+	int reg = this->num_inputs;
 
-	E arguments[this->max_arity];
+	this->program.clear();
 
-	// call all function functions in the active_nodes.
 	for (auto it = active_nodes->begin(); it != active_nodes->end(); it++) {
 
 		node_num = *it;
-
 		node_pos = this->species->position_from_node_number(node_num);
-		function = this->gene_at(genome, node_pos);
 
-		// Evaluate each input connection of the nodes 
-		for (int i = 0; i < this->max_arity; i++) {
+		int function = this->gene_at(genome, node_pos);
+		int arity = this->arity_of(function);
+
+		this->program.functions.push_back(function);
+		this->program.arities.push_back(arity);
+		this->program.nodes.push_back(node_num);
+
+		// Inputs keep their index as register, nodes use their compact register.
+		// Connection genes beyond the arity of the function are not compiled.
+		for (int i = 0; i < arity; i++) {
 			node_arg = this->gene_at(genome, node_pos + i + 1);
 
-			//  Get the input values from the node value mapping or directly from the inputs
 			if (node_arg < this->num_inputs) {
-				arguments[i] = inputs->at(node_arg);
+				this->program.operands.push_back(node_arg);
 			} else {
-				arguments[i] = this->node_value_map.at(node_arg);
+				this->program.operands.push_back(this->node_registers[node_arg]);
 			}
 		}
 
-		E result = this->functions->call_function(arguments, function);
-
-		this->node_value_map.insert( { node_num, result });
+		this->node_registers[node_num] = reg++;
 	}
 
-	E value;
-
-	// Pushes the output nodes to the output vector.
 	for (int i = 0; i < this->num_outputs; i++) {
 		output_pos = this->genome_size - i - 1;
 		output_val = gene_at(genome, output_pos);
 
-		// Get the output value directly from the inputs or from the 
-		// node -  value mapping
 		if (output_val < this->num_inputs) {
-			value = inputs->at(output_val);
+			this->program.outputs.push_back(output_val);
 		} else {
-			value = this->node_value_map.at(output_val);
+			this->program.outputs.push_back(this->node_registers[output_val]);
 		}
-
-		outputs->push_back(value);
 	}
 
+	return this->program;
 }
 
-/// @brief Function that visits a function node to obtain the active nodes
-/// @details The function recursively visits connected nodes and updates the map of visited active nodes.
-/// @param genome genome of the CGP individual
-/// @param active_nodes vector for the storage of active nodes
-/// @param node_num current node number
-/// @param num_inputs number of inputs
+/// @brief Runs the instructions of a program on a register file.
+/// @details The input registers must have been filled before. 
+/// @param program compiled program
+/// @param registers register file 
 template<class E, class G, class F>
-void Evaluator<E, G, F>::visit_node(std::shared_ptr<G[]> genome,
-		std::shared_ptr<std::vector<int>> active_nodes, int node_num,
-		int num_inputs) {
+void Evaluator<E, G, F>::run(const Program &program, E *registers) {
 
-	// Check if the node has already been visited, and return if it has.
-	if (this->node_number_map.count(node_num) == 1) {
+	if (this->static_dispatch) {
+		StaticKernel<E, StaticFunctions<E>>::run(program, registers);
 		return;
 	}
 
-	// Check if the node is within the input nodes, and return if it is.
-	if (node_num < num_inputs) {
+	const int *operands = program.operands.data();
+	const int *functions = program.functions.data();
+	const int *arities = program.arities.data();
+	int size = program.size();
+	int num_inputs = program.num_inputs;
+
+	std::array<E, Functions<E>::MAX_ARITY> arguments;
+
+	for (int k = 0; k < size; k++) {
+		for (int i = 0; i < arities[k]; i++) {
+			arguments[i] = registers[operands[i]];
+		}
+
+		registers[num_inputs + k] = this->functions->call_function(
+				arguments.data(), functions[k]);
+
+		operands += arities[k];
+	}
+}
+
+/// @brief Runs the instructions of a program on a block register file.
+/// @details Each instruction is applied to all lanes at once by the block kernel 
+/// of the function set. 
+/// @param program compiled program
+/// @param registers block register file
+/// @param lanes number of used lanes
+template<class E, class G, class F>
+void Evaluator<E, G, F>::run_block(const Program &program, E *registers,
+		int lanes) {
+
+	size_t stride = this->block_lanes;
+
+	if (this->static_dispatch) {
+		StaticKernel<E, StaticFunctions<E>>::run_block(program, registers,
+				stride, lanes);
 		return;
 	}
 
+	const int *operands = program.operands.data();
+	const int *functions = program.functions.data();
+	const int *arities = program.arities.data();
+	int size = program.size();
+	int num_inputs = program.num_inputs;
 
-	// Add the current node to the list of active nodes.
-	active_nodes->push_back(node_num);
-	this->node_number_map.insert( { node_num, 1 });
+	std::array<const E*, Functions<E>::MAX_ARITY> arguments = { };
 
-	int connection_gene;
-	int position = this->species->position_from_node_number(node_num);
+	for (int k = 0; k < size; k++) {
+		for (int i = 0; i < arities[k]; i++) {
+			arguments[i] = registers + operands[i] * stride;
+		}
 
+		this->functions->call_function_block(arguments.data(),
+				registers + (num_inputs + k) * stride, lanes, functions[k]);
 
-	// Visit all connected nodes up to the maximum arity.
-	for (int i = 1; i <= this->max_arity; i++) {
-		connection_gene = gene_at(genome, position + i);
-		visit_node(genome, active_nodes, connection_gene, num_inputs);
+		operands += arities[k];
 	}
 }
 
-/// @brief Recursive decoding of the path of the corresponding graph of an CGP indvidual.
-/// @details The path is decoded by using recursion. 
-/// @see Recursive evaluation in evaluate_recursive()
+/// @brief Returns the arity of a function, without a virtual call if possible.
+template<class E, class G, class F>
+int Evaluator<E, G, F>::arity_of(int function) {
+	if (this->static_dispatch) {
+		return StaticFunctions<E>::arity(function);
+	}
+	return this->functions->arity_of(function);
+}
+
+/// @brief Returns the block register file.
+/// @details Register r of lane l is located at index r * get_block_lanes() + l. 
+/// The input registers have to be filled before execute_block() is called, 
+/// afterwards the output registers of the program hold the results.
+template<class E, class G, class F>
+E* Evaluator<E, G, F>::get_block_registers() {
+	return this->block_values.data();
+}
+
+/// @brief Returns the maximum number of instances in a block.
+template<class E, class G, class F>
+int Evaluator<E, G, F>::get_block_lanes() const {
+	return this->block_lanes;
+}
+
+/// @brief Sets the maximum number of instances in a block.
+/// @details Defaults to BLOCK_LANES. Problems with column-major data use wider 
+/// blocks, e.g. symbolic regression evaluates whole columns of the dataset.
+/// @param p_block_lanes number of lanes
+template<class E, class G, class F>
+void Evaluator<E, G, F>::set_block_lanes(int p_block_lanes) {
+
+	if (p_block_lanes < 1) {
+		throw std::invalid_argument("Block size must be positive!");
+	}
+
+	this->block_lanes = p_block_lanes;
+	this->block_values.resize(this->node_values.size() * p_block_lanes);
+}
+
+/// @brief Executes a compiled program for a block of instances.
+/// @details The inputs must have been written to the block register file. 
+/// @param program compiled program
+/// @param lanes number of instances in the block, at most get_block_lanes()
+template<class E, class G, class F>
+void Evaluator<E, G, F>::execute_block(const Program &program, int lanes) {
+	this->run_block(program, this->block_values.data(), lanes);
+}
+
+/// @brief Executes a compiled program for one instance.
+/// @details Copies the inputs into the register file, runs the instructions in 
+/// order and pushes the output registers to the output vector. 
+/// @param program compiled program
+/// @param inputs input row of the instance (variables followed by constants)
+/// @param outputs outputs vector to store evalation results
+template<class E, class G, class F>
+void Evaluator<E, G, F>::execute(const Program &program, const E *inputs,
+		std::vector<E> &outputs) {
+
+	E *registers = this->node_values.data();
+
+	std::copy(inputs, inputs + program.num_inputs, registers);
+
+	this->run(program, registers);
+
+	for (int reg : program.outputs) {
+		outputs.push_back(registers[reg]);
+	}
+}
+
+/// @brief Compiles the part of an offspring that differs from the cached parent.
+/// @details A node has to be recomputed (dirty) if one of its genes differs from the 
+/// cached genome, if it was not active in the cached parent or if one of its 
+/// connections is dirty, i.e. the program covers the forward cone of the changed genes. 
+/// Values of clean nodes and inputs that are needed by dirty nodes or outputs are 
+/// loaded from the cache row into the input registers of the program.
+/// The program is owned by the evaluator and valid until the next compilation.
+/// @param individual decoded CGP individual
+/// @param cache node values of the parent
+/// @return reference to the compiled incremental program
+template<class E, class G, class F>
+const Program& Evaluator<E, G, F>::compile_incremental(
+		const std::shared_ptr<Individual<G, F>> &individual,
+		const NodeCache<E, G, F> &cache) {
+
+	std::shared_ptr<std::vector<int>> active_nodes =
+			individual->get_active_nodes();
+
+	const G *genome = individual->get_genome().get();
+	const G *cached_genome = cache.get_genome();
+
+	Program &program = this->incremental_program;
+
+	int node_num;
+	int node_pos;
+	int node_arg;
+	int output_val;
+	int output_pos;
+	int num_dirty = 0;
+	bool is_dirty;
+
+	program.clear();
+
+	// Loads are numbered from zero, instruction results are encoded as -(k + 1) 
+	// until the number of loads is known
+	auto operand_of = [&](int node) {
+		if (node >= this->num_inputs && this->dirty[node]) {
+			return -(this->node_registers[node] + 1);
+		}
+		if (this->load_registers[node] == -1) {
+			this->load_registers[node] = program.loads.size();
+			program.loads.push_back(node);
+		}
+		return this->load_registers[node];
+	};
+
+	for (auto it = active_nodes->begin(); it != active_nodes->end(); it++) {
+
+		node_num = *it;
+		node_pos = this->species->position_from_node_number(node_num);
+
+		is_dirty = !cache.is_valid(node_num);
+
+		for (int i = 0; i <= this->max_arity && !is_dirty; i++) {
+			is_dirty = genome[node_pos + i] != cached_genome[node_pos + i];
+		}
+
+		for (int i = 1; i <= this->max_arity && !is_dirty; i++) {
+			node_arg = this->gene_at(genome, node_pos + i);
+			is_dirty = node_arg >= this->num_inputs && this->dirty[node_arg];
+		}
+
+		this->dirty[node_num] = is_dirty;
+
+		if (is_dirty) {
+			this->node_registers[node_num] = num_dirty++;
+		}
+	}
+
+	for (auto it = active_nodes->begin(); it != active_nodes->end(); it++) {
+
+		node_num = *it;
+
+		if (!this->dirty[node_num]) {
+			continue;
+		}
+
+		node_pos = this->species->position_from_node_number(node_num);
+
+		int function = this->gene_at(genome, node_pos);
+		int arity = this->arity_of(function);
+
+		program.functions.push_back(function);
+		program.arities.push_back(arity);
+		program.nodes.push_back(node_num);
+
+		for (int i = 1; i <= arity; i++) {
+			node_arg = this->gene_at(genome, node_pos + i);
+			program.operands.push_back(operand_of(node_arg));
+		}
+	}
+
+	for (int i = 0; i < this->num_outputs; i++) {
+		output_pos = this->genome_size - i - 1;
+		output_val = gene_at(genome, output_pos);
+		program.outputs.push_back(operand_of(output_val));
+	}
+
+	// Resolve the instruction results to the registers behind the loads 
+	program.num_inputs = program.loads.size();
+
+	for (int &operand : program.operands) {
+		if (operand < 0) {
+			operand = program.num_inputs - operand - 1;
+		}
+	}
+
+	for (int &operand : program.outputs) {
+		if (operand < 0) {
+			operand = program.num_inputs - operand - 1;
+		}
+	}
+
+	// Only the active nodes and loads have been flagged in this compilation 
+	for (int node : *active_nodes) {
+		this->dirty[node] = 0;
+	}
+
+	for (int node : program.loads) {
+		this->load_registers[node] = -1;
+	}
+
+	return program;
+}
+
+/// @brief Returns the register file of the most recent execution.
+template<class E, class G, class F>
+const E* Evaluator<E, G, F>::get_registers() const {
+	return this->node_values.data();
+}
+
+/// @brief Decoding of the path of the corresponding graph of an CGP indvidual.
+/// @details Marks the nodes referenced by the outputs and sweeps backwards over the 
+/// node numbers. Since connection genes only refer to preceding nodes, every active 
+/// node has been marked before the sweep reaches it, so neither recursion nor sorting 
+/// is needed. Words of the bitset without marked nodes are skipped as a whole. 
 /// @param individual CGP individual to decode
 template<class E, class G, class F>
 void Evaluator<E, G, F>::decode_path(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	std::shared_ptr<std::vector<int>> active_nodes =
 			individual->get_active_nodes();
 
-	std::shared_ptr<G[]> genome = individual->get_genome();
+	const G *genome = individual->get_genome().get();
+	std::uint64_t *bits = this->active_bits.data();
 
 	active_nodes->clear();
-	this->node_number_map.clear();
+	std::fill(this->active_bits.begin(), this->active_bits.end(), 0);
 
-	int output;
-	for (int i = 0; i < num_outputs; i++) {
-		int position = genome_size - i - 1;
-		output = gene_at(genome, position);
-		visit_node(genome, active_nodes, output, num_inputs);
+	int node_num;
+	for (int i = 0; i < this->num_outputs; i++) {
+		node_num = this->gene_at(genome, this->genome_size - i - 1);
+		bits[node_num >> 6] |= std::uint64_t(1) << (node_num & 63);
 	}
 
-	std::sort(active_nodes->begin(), active_nodes->end());
+	int position;
+	int connection_gene;
+	int last = this->node_registers.size() - 1;
+
+	for (node_num = last; node_num >= this->num_inputs; node_num--) {
+		std::uint64_t word = bits[node_num >> 6];
+
+		if (word == 0) {
+			node_num &= ~63;
+			continue;
+		}
+
+		if (((word >> (node_num & 63)) & 1) == 0) {
+			continue;
+		}
+
+		active_nodes->push_back(node_num);
+		position = this->species->position_from_node_number(node_num);
+
+		for (int i = 1; i <= this->max_arity; i++) {
+			connection_gene = this->gene_at(genome, position + i);
+			bits[connection_gene >> 6] |= std::uint64_t(1)
+					<< (connection_gene & 63);
+		}
+	}
+
+	std::reverse(active_nodes->begin(), active_nodes->end());
+
+	individual->set_phenotype_hash(this->hash_phenotype(genome, active_nodes));
+}
+
+/// @brief Mixes a value into a hash.
+template<class E, class G, class F>
+std::uint64_t Evaluator<E, G, F>::hash_combine(std::uint64_t hash,
+		std::uint64_t value) {
+	hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+	hash ^= hash >> 31;
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	return hash ^ (hash >> 29);
+}
+
+/// @brief Computes a canonical hash of the active graph.
+/// @details The active nodes are relabeled to num_inputs + k in ascending order, so
+/// that the hash does not depend on the position of the active nodes in the genome.
+/// Only the functions, the connections within the arity of each function and the
+/// outputs are hashed. Individuals that differ in inactive genes only share the hash.
+/// The hashed values are kept as canonical phenotype (see get_phenotype()).
+/// @param genome genome of the individual
+/// @param active_nodes sorted active nodes of the individual
+/// @return phenotype hash
+template<class E, class G, class F>
+std::uint64_t Evaluator<E, G, F>::hash_phenotype(const G *genome,
+		const std::shared_ptr<std::vector<int>> &active_nodes) {
+
+	this->phenotype.clear();
+	this->phenotype.push_back(active_nodes->size());
+
+	int node_num;
+	int node_pos;
+	int node_arg;
+	int function;
+	int label = this->num_inputs;
+
+	for (auto it = active_nodes->begin(); it != active_nodes->end(); it++) {
+		node_num = *it;
+		node_pos = this->species->position_from_node_number(node_num);
+
+		function = this->gene_at(genome, node_pos);
+		this->phenotype.push_back(function);
+
+		int num_arguments = this->arity_of(function);
+		for (int i = 0; i < num_arguments; i++) {
+			node_arg = this->gene_at(genome, node_pos + i + 1);
+
+			if (node_arg >= this->num_inputs) {
+				node_arg = this->node_registers[node_arg];
+			}
+
+			this->phenotype.push_back(node_arg);
+		}
+
+		this->node_registers[node_num] = label++;
+	}
+
+	for (int i = 0; i < this->num_outputs; i++) {
+		node_arg = this->gene_at(genome, this->genome_size - i - 1);
+
+		if (node_arg >= this->num_inputs) {
+			node_arg = this->node_registers[node_arg];
+		}
+
+		this->phenotype.push_back(node_arg);
+	}
+
+	std::uint64_t hash = 0;
+
+	for (int value : this->phenotype) {
+		hash = this->hash_combine(hash, value);
+	}
+
+	return hash;
 }
 
+/// @brief Returns the canonical phenotype of the individual decoded most recently.
+/// @details Holds the functions and relabeled connections of the active nodes followed
+/// by the outputs (see hash_phenotype()). Used to verify fitness cache entries.
+template<class E, class G, class F>
+const std::vector<int>& Evaluator<E, G, F>::get_phenotype() const {
+	return this->phenotype;
+}
 
 /// @brief Recursive decoding of the expression of a CGP indvidual 
 /// @details Decodes the path of of an CGP indidual and creates the corresponding symbolic expression. 
 /// @see Recursive evaluation in evaluate_recursive()
 /// @param individual CGP individual 
 template<class E, class G, class F>
-void Evaluator<E, G, F>::decode_expression(std::shared_ptr<G[]> genome,
+void Evaluator<E, G, F>::decode_expression(const G *genome,
 		std::shared_ptr<std::string[]> expressions) {
 
 	int num_outputs = parameters->get_num_outputs();
@@ -528,7 +983,7 @@ void Evaluator<E, G, F>::decode_expression(std::shared_ptr<G[]> genome,
 /// @return The decoded expression of the node.
 template<class E, class G, class F>
 std::string Evaluator<E, G, F>::decode_node_expression(
-		std::shared_ptr<G[]> genome, std::stringstream *expression_stream,
+		const G *genome, std::stringstream *expression_stream,
 		int node_num, int num_inputs) {
 
 	// Check if the expression for the node has already been decoded
@@ -555,7 +1010,7 @@ std::string Evaluator<E, G, F>::decode_node_expression(
 
 	function = gene_at(genome, position);
 
-	int num_arguments = this->functions->arity_of(function);
+	int num_arguments = this->arity_of(function);
 
 	// Get the function name 
 	std::string function_name = functions->function_name(function);
@@ -0,0 +1,183 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: NodeCache.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef EVALUATOR_NODECACHE_H_
+#define EVALUATOR_NODECACHE_H_
+
+#include "../parameters/Parameters.h"
+#include "../representation/Individual.h"
+
+#include <stdexcept>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+/// @brief Node values of an offspring that differ from the cached parent.
+/// @details Stores the values of the recomputed nodes for each evaluated instance
+/// (all instances or the current mini-batch). Row r holds the values of instance
+/// instances[r] and is located at values[r * nodes.size()].
+/// The overlay is incomplete if the offspring has not been evaluated node by node,
+/// e.g. because its fitness was found in the fitness cache.
+/// @tparam E Evaluation type
+template<class E>
+struct NodeOverlay {
+	std::vector<int> nodes;
+	std::vector<int> instances;
+	std::vector<E> values;
+
+	bool complete = true;
+};
+
+/// @brief Cache of the node values of a parent individual for all problem instances.
+/// @details Each instance has a row that is indexed by node number and holds the inputs
+/// followed by the values of the function nodes. Only the rows of nodes that are
+/// active in the cached parent are valid. Offspring only have to recompute the
+/// nodes that depend on changed genes (see Evaluator::compile_incremental()).
+/// @tparam E Evaluation type
+/// @tparam G Genome type
+/// @tparam F Fitness type
+template<class E, class G, class F>
+class NodeCache {
+private:
+	int num_instances;
+	int row_size;
+	int genome_size;
+
+	bool ready;
+
+	std::vector<E> values;
+	std::vector<char> valid;
+	std::vector<G> genome;
+
+public:
+	NodeCache(std::shared_ptr<Parameters> p_parameters, int p_num_instances);
+	virtual ~NodeCache() = default;
+
+	void reset();
+	void assign(const std::shared_ptr<Individual<G, F>> &individual);
+	void patch(const std::shared_ptr<Individual<G, F>> &individual,
+			const NodeOverlay<E> &overlay);
+
+	E* row(int instance);
+	const E* row(int instance) const;
+
+	bool is_ready() const;
+	bool is_valid(int node_num) const;
+	const G* get_genome() const;
+	int get_num_instances() const;
+};
+
+/// @brief Constructor that allocates the rows for all instances.
+/// @param p_parameters shared pointer to parameter object
+/// @param p_num_instances number of problem instances
+template<class E, class G, class F>
+NodeCache<E, G, F>::NodeCache(std::shared_ptr<Parameters> p_parameters,
+		int p_num_instances) {
+
+	if (p_parameters == nullptr) {
+		throw std::invalid_argument("Nullpointer exception in node cache class!");
+	}
+
+	num_instances = p_num_instances;
+	row_size = p_parameters->get_num_inputs()
+			+ p_parameters->get_num_function_nodes();
+	genome_size = p_parameters->get_genome_size();
+
+	values.resize((size_t) num_instances * row_size);
+	valid.resize(row_size);
+	genome.resize(genome_size);
+
+	ready = false;
+}
+
+/// @brief Invalidates the cache, e.g. at the start of a job.
+template<class E, class G, class F>
+void NodeCache<E, G, F>::reset() {
+	this->ready = false;
+	std::fill(this->valid.begin(), this->valid.end(), 0);
+}
+
+/// @brief Marks the cache as holding the node values of the given individual.
+/// @details The rows must have been filled with the values of the individual before.
+/// @param individual cached individual
+template<class E, class G, class F>
+void NodeCache<E, G, F>::assign(const std::shared_ptr<Individual<G, F>> &individual) {
+
+	const G *genome_ptr = individual->get_genome().get();
+	std::copy(genome_ptr, genome_ptr + this->genome_size,
+			this->genome.begin());
+
+	std::fill(this->valid.begin(), this->valid.end(), 0);
+
+	for (int node_num : *individual->get_active_nodes()) {
+		this->valid[node_num] = 1;
+	}
+
+	this->ready = true;
+}
+
+/// @brief Moves the cache to an offspring of the cached parent.
+/// @details Writes the recomputed node values of the offspring into the rows of the
+/// instances it has been evaluated on. Afterwards the nodes that are active in the
+/// offspring are valid.
+/// @param individual offspring that has been evaluated against this cache
+/// @param overlay recomputed node values of the offspring
+template<class E, class G, class F>
+void NodeCache<E, G, F>::patch(const std::shared_ptr<Individual<G, F>> &individual,
+		const NodeOverlay<E> &overlay) {
+
+	int num_nodes = overlay.nodes.size();
+	int num_rows = overlay.instances.size();
+
+	for (int r = 0; r < num_rows; r++) {
+		E *instance_row = this->row(overlay.instances[r]);
+		const E *overlay_values = overlay.values.data() + (size_t) r * num_nodes;
+
+		for (int k = 0; k < num_nodes; k++) {
+			instance_row[overlay.nodes[k]] = overlay_values[k];
+		}
+	}
+
+	this->assign(individual);
+}
+
+template<class E, class G, class F>
+E* NodeCache<E, G, F>::row(int instance) {
+	return this->values.data() + (size_t) instance * this->row_size;
+}
+
+template<class E, class G, class F>
+const E* NodeCache<E, G, F>::row(int instance) const {
+	return this->values.data() + (size_t) instance * this->row_size;
+}
+
+template<class E, class G, class F>
+bool NodeCache<E, G, F>::is_ready() const {
+	return this->ready;
+}
+
+template<class E, class G, class F>
+bool NodeCache<E, G, F>::is_valid(int node_num) const {
+	return this->valid[node_num];
+}
+
+template<class E, class G, class F>
+const G* NodeCache<E, G, F>::get_genome() const {
+	return this->genome.data();
+}
+
+template<class E, class G, class F>
+int NodeCache<E, G, F>::get_num_instances() const {
+	return this->num_instances;
+}
+
+#endif /* EVALUATOR_NODECACHE_H_ */
@@ -0,0 +1,63 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: Program.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef EVALUATOR_PROGRAM_H_
+#define EVALUATOR_PROGRAM_H_
+
+#include <vector>
+
+/// @brief Straight-line program compiled from the active graph of a CGP individual.
+/// @details Registers 0 to num_inputs - 1 hold the inputs, the result of the i-th
+/// instruction is written to register num_inputs + i. Each instruction stores its
+/// function, its arity and as many source registers as the function takes, so the
+/// operands of consecutive instructions are packed without unused slots. Since the 
+/// active nodes are compiled in ascending order, every source register has been 
+/// written before it is read.
+/// Incremental programs fill their input registers from the node numbers listed in 
+/// loads instead of the problem inputs (see Evaluator::compile_incremental()).
+struct Program {
+	int num_inputs = 0;
+	int max_arity = 0;
+
+	std::vector<int> functions;
+	std::vector<int> arities;
+	std::vector<int> operands;
+	std::vector<int> outputs;
+
+	// Node number computed by each instruction
+	std::vector<int> nodes;
+
+	// Node numbers loaded into the input registers of incremental programs
+	std::vector<int> loads;
+
+	/// @brief Returns the number of instructions.
+	int size() const {
+		return this->functions.size();
+	}
+
+	/// @brief Returns the number of registers used by the program.
+	int num_registers() const {
+		return this->num_inputs + this->size();
+	}
+
+	/// @brief Removes all instructions and outputs.
+	void clear() {
+		this->functions.clear();
+		this->arities.clear();
+		this->operands.clear();
+		this->outputs.clear();
+		this->nodes.clear();
+		this->loads.clear();
+	}
+};
+
+#endif /* EVALUATOR_PROGRAM_H_ */
@@ -0,0 +1,101 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: StaticKernel.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef EVALUATOR_STATICKERNEL_H_
+#define EVALUATOR_STATICKERNEL_H_
+
+#include "Program.h"
+#include "../functions/BooleanFunctions.h"
+#include "../functions/MathematicalFunctions.h"
+
+#include <type_traits>
+#include <cstddef>
+
+/// @brief Runs compiled programs with a function set and arity that are known at compile time.
+/// @details Calls the static interface of the function set (apply() and apply_block())
+/// instead of the virtual functions of Functions<E>. The argument loop has a constant
+/// trip count and the function dispatch can be inlined, so the compiler unrolls the
+/// argument loads and turns the switch into a jump table in the instruction loop.
+/// Programs must have been compiled with max_arity equal to ARITY.
+/// @tparam E Evaluation type
+/// @tparam FS Function set with a static interface
+/// @tparam ARITY Maximum arity of the function set
+template<class E, class FS, int ARITY = FS::ARITY>
+struct StaticKernel {
+
+	/// @brief Runs the instructions of a program on a register file.
+	/// @param program compiled program
+	/// @param registers register file with the input registers filled
+	static void run(const Program &program, E *registers) {
+
+		const int *operands = program.operands.data();
+		const int *functions = program.functions.data();
+		const int *arities = program.arities.data();
+		const int size = program.size();
+		E *results = registers + program.num_inputs;
+
+		E arguments[ARITY];
+
+		for (int k = 0; k < size; k++) {
+			const int arity = arities[k];
+
+			// Slots beyond the arity repeat the first operand, so the loop keeps its
+			// constant trip count without reading the operands of the next instruction
+			for (int i = 0; i < ARITY; i++) {
+				arguments[i] = registers[operands[i < arity ? i : 0]];
+			}
+
+			results[k] = FS::apply(arguments, functions[k]);
+
+			operands += arity;
+		}
+	}
+
+	/// @brief Runs the instructions of a program on a block register file.
+	/// @param program compiled program
+	/// @param registers block register file with the input registers filled
+	/// @param stride number of lanes per register
+	/// @param lanes number of used lanes
+	static void run_block(const Program &program, E *registers,
+			std::size_t stride, int lanes) {
+
+		const int *operands = program.operands.data();
+		const int *functions = program.functions.data();
+		const int *arities = program.arities.data();
+		const int size = program.size();
+		E *results = registers + program.num_inputs * stride;
+
+		const E *arguments[ARITY] = {};
+
+		for (int k = 0; k < size; k++) {
+			for (int i = 0; i < arities[k]; i++) {
+				arguments[i] = registers + operands[i] * stride;
+			}
+
+			FS::apply_block(arguments, results + k * stride, lanes,
+					functions[k]);
+
+			operands += arities[k];
+		}
+	}
+};
+
+/// @brief Function set of the specialized evaluator for an evaluation type.
+/// @details Floating point types use the mathematical set, integral types the Boolean
+/// set, matching the types accepted by Validation::validate_sr_type() and
+/// Validation::validate_ls_type().
+/// @tparam E Evaluation type
+template<class E>
+using StaticFunctions = typename std::conditional<std::is_floating_point<E>::value,
+		FunctionsMathematical<E>, FunctionsBoolean<E>>::type;
+
+#endif /* EVALUATOR_STATICKERNEL_H_ */
@@ -0,0 +1,279 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: TestValidator.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef EVALUATOR_TESTVALIDATOR_H_
+#define EVALUATOR_TESTVALIDATOR_H_
+
+#include "../problems/BlackBoxProblem.h"
+#include "../representation/Individual.h"
+
+#include <stdexcept>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <fstream>
+#include <sstream>
+
+/// @brief Background thread that validates snapshots of the best individual on held-out test data.
+/// @details The validator owns a problem with the test data and its own evaluator, so
+/// it can run concurrently with the evolution. Snapshots are deep copies of the best
+/// individual. If a new snapshot arrives before the previous one has been picked up,
+/// the previous one is dropped (coalesced), so the evolution never waits for the
+/// validator. Results are written to the statfile of the running job.
+/// @tparam E Evaluation type
+/// @tparam G Genome type
+/// @tparam F Fitness type
+template<class E, class G, class F>
+class TestValidator {
+public:
+	/// @brief Result of the validation of a snapshot.
+	struct TestResult {
+		int generation = -1;
+		F fitness = 0;
+		int hits = -1;
+		// confusion[label * num_classes + prediction]
+		std::vector<long long> confusion;
+	};
+
+private:
+	std::shared_ptr<BlackBoxProblem<E, G, F>> problem;
+
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable snapshot_available;
+	std::condition_variable snapshot_finished;
+
+	std::shared_ptr<Individual<G, F>> snapshot;
+	int snapshot_generation;
+	bool busy;
+	bool stopping;
+
+	int job;
+	std::shared_ptr<std::ofstream> ofs;
+
+	long long num_validated;
+	long long num_coalesced;
+
+	TestResult last_result;
+
+	void work();
+	void write(const TestResult &result, int p_job, std::ofstream &stream);
+
+public:
+	TestValidator(std::shared_ptr<BlackBoxProblem<E, G, F>> p_problem);
+	~TestValidator();
+
+	TestValidator(const TestValidator&) = delete;
+	TestValidator& operator=(const TestValidator&) = delete;
+
+	void start_job(int p_job, std::shared_ptr<std::ofstream> p_ofs);
+	void submit(const std::shared_ptr<Individual<G, F>> &individual,
+			int generation);
+	void wait();
+
+	TestResult get_last_result();
+	long long get_num_validated();
+	long long get_num_coalesced();
+	int get_num_samples() const;
+};
+
+/// @brief Constructor that starts the validator thread.
+/// @param p_problem problem with the test data, used by the validator thread only
+template<class E, class G, class F>
+TestValidator<E, G, F>::TestValidator(
+		std::shared_ptr<BlackBoxProblem<E, G, F>> p_problem) {
+
+	if (p_problem == nullptr) {
+		throw std::invalid_argument(
+				"Nullpointer exception in test validator class!");
+	}
+
+	if (p_problem->get_num_classes() <= 0) {
+		throw std::invalid_argument(
+				"Test validation requires a classification problem!");
+	}
+
+	problem = p_problem;
+
+	snapshot_generation = 0;
+	busy = false;
+	stopping = false;
+
+	job = 0;
+	num_validated = 0;
+	num_coalesced = 0;
+
+	worker = std::thread(&TestValidator<E, G, F>::work, this);
+}
+
+/// @brief Stops the validator after the pending snapshot has been validated and joins it.
+template<class E, class G, class F>
+TestValidator<E, G, F>::~TestValidator() {
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		this->stopping = true;
+	}
+
+	this->snapshot_available.notify_all();
+	this->worker.join();
+}
+
+/// @brief Validator loop that picks up the most recent snapshot.
+template<class E, class G, class F>
+void TestValidator<E, G, F>::work() {
+
+	while (true) {
+		std::shared_ptr<Individual<G, F>> individual;
+		TestResult result;
+		int p_job;
+		std::shared_ptr<std::ofstream> stream;
+
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->snapshot_available.wait(lock, [this] {
+				return this->stopping || this->snapshot != nullptr;
+			});
+
+			if (this->snapshot == nullptr) {
+				return;
+			}
+
+			individual = std::move(this->snapshot);
+			this->snapshot = nullptr;
+			result.generation = this->snapshot_generation;
+			p_job = this->job;
+			stream = this->ofs;
+			this->busy = true;
+		}
+
+		result.fitness = individual->get_fitness();
+		result.hits = this->problem->classify_individual(individual,
+				result.confusion);
+
+		if (stream != nullptr) {
+			this->write(result, p_job, *stream);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->last_result = std::move(result);
+			this->num_validated++;
+			this->busy = false;
+		}
+
+		this->snapshot_finished.notify_all();
+	}
+}
+
+/// @brief Writes the test accuracy and the confusion matrix of a snapshot.
+template<class E, class G, class F>
+void TestValidator<E, G, F>::write(const TestResult &result, int p_job,
+		std::ofstream &stream) {
+
+	int num_samples = this->problem->get_num_samples();
+	int num_classes = this->problem->get_num_classes();
+
+	std::stringstream ss;
+	ss << "Test # " << p_job << " :: Generation: " << result.generation
+			<< " :: Best Fitness: " << result.fitness << " :: Test Accuracy: "
+			<< result.hits << "/" << num_samples << " ("
+			<< (double) result.hits / num_samples * 100.0 << "%)" << std::endl;
+
+	ss << "Confusion Matrix (rows: label, columns: prediction)" << std::endl;
+	for (int label = 0; label < num_classes; label++) {
+		ss << label << ":";
+		for (int prediction = 0; prediction < num_classes; prediction++) {
+			ss << " " << result.confusion[label * num_classes + prediction];
+		}
+		ss << std::endl;
+	}
+
+	stream << ss.rdbuf();
+}
+
+/// @brief Sets the job number and the statfile for the following snapshots.
+/// @details Must only be called while the validator is idle (see wait()).
+/// @param p_job job number
+/// @param p_ofs statfile stream, nullptr if no statfile is written
+template<class E, class G, class F>
+void TestValidator<E, G, F>::start_job(int p_job,
+		std::shared_ptr<std::ofstream> p_ofs) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->job = p_job;
+	this->ofs = p_ofs;
+	this->num_validated = 0;
+	this->num_coalesced = 0;
+	this->last_result = TestResult();
+}
+
+/// @brief Passes a deep copy of an individual to the validator without waiting.
+/// @details Replaces a snapshot that has not been picked up yet.
+/// @param individual evaluated individual
+/// @param generation generation of the snapshot
+template<class E, class G, class F>
+void TestValidator<E, G, F>::submit(
+		const std::shared_ptr<Individual<G, F>> &individual, int generation) {
+
+	std::shared_ptr<Individual<G, F>> copy = std::make_shared<Individual<G, F>>(
+			individual);
+
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		if (this->snapshot != nullptr) {
+			this->num_coalesced++;
+		}
+
+		this->snapshot = std::move(copy);
+		this->snapshot_generation = generation;
+	}
+
+	this->snapshot_available.notify_one();
+}
+
+/// @brief Blocks until the pending snapshot has been validated.
+template<class E, class G, class F>
+void TestValidator<E, G, F>::wait() {
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->snapshot_finished.wait(lock, [this] {
+		return this->snapshot == nullptr && !this->busy;
+	});
+}
+
+/// @brief Returns the result of the most recently validated snapshot.
+template<class E, class G, class F>
+typename TestValidator<E, G, F>::TestResult TestValidator<E, G, F>::get_last_result() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->last_result;
+}
+
+template<class E, class G, class F>
+long long TestValidator<E, G, F>::get_num_validated() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->num_validated;
+}
+
+template<class E, class G, class F>
+long long TestValidator<E, G, F>::get_num_coalesced() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->num_coalesced;
+}
+
+/// @brief Returns the number of samples of the test data.
+template<class E, class G, class F>
+int TestValidator<E, G, F>::get_num_samples() const {
+	return this->problem->get_num_samples();
+}
+
+#endif /* EVALUATOR_TESTVALIDATOR_H_ */
@@ -50,6 +50,8 @@ private:
 	std::shared_ptr<EvolutionaryAlgorithm<E, G, F>> algorithm;
 	std::shared_ptr<AbstractPopulation<G, F>> population;
 
+	std::shared_ptr<TestValidator<E, G, F>> validator;
+
 	void print_configuration();
 
 public:
@@ -84,6 +86,7 @@ Evolver<E, G, F>::Evolver(std::shared_ptr<Initializer<E, G, F>> p_initializer) {
 
 	this->population = this->composite->get_population();
 	this->algorithm = this->initializer->get_algorithm();
+	this->validator = this->composite->get_validator();
 }
 
 /// @brief Prints the CGP++ configuration that has been defined for the experiment
@@ -202,6 +205,12 @@ void Evolver<E, G, F>::execute_job(int job,
 	std::stringstream ss;
 	std::chrono::duration<double> duration;
 
+	typename TestValidator<E, G, F>::TestResult test_result;
+
+	if (this->validator != nullptr) {
+		this->validator->start_job(job, ofs);
+	}
+
 	// Start EA and measures the runtime
 	auto start = std::chrono::high_resolution_clock::now();
 	result = algorithm->evolve();
@@ -209,6 +218,24 @@ void Evolver<E, G, F>::execute_job(int job,
 
 	duration = end - start;
 
+	// The population already holds the unevaluated offspring of the last breeding,
+	// so the best individual is taken from the selection of the algorithm
+	std::shared_ptr<Individual<G, F>> best = this->algorithm->get_best_individual();
+
+	if (best == nullptr) {
+		this->population->sort();
+		best = this->population->get_individual(0);
+	}
+
+	// Validate the final best individual on the test data. Waiting also ensures that
+	// the validator has finished writing to the statfile.
+	if (this->validator != nullptr) {
+		this->validator->submit(best,
+				this->algorithm->get_generation_number() - 1);
+		this->validator->wait();
+		test_result = this->validator->get_last_result();
+	}
+
 	// Do reporting after the job if desired. 
 	if (this->report_after_job) {
 		if (this->report_simple) {
@@ -219,18 +246,56 @@ void Evolver<E, G, F>::execute_job(int job,
 				ss << result.second << std::endl;
 			}
 		} else {
-			this->population->sort();
-            auto best_ind = this->population->get_individual(0);
+            auto best_ind = best;
 
             // 2. Calcola l'accuratezza finale
             auto problem = this->composite->get_problem();
+
+            // Individuals evaluated on mini-batches are reported on all instances
+            if (problem->is_batched()) {
+                best_ind = problem->evaluate_full(best_ind);
+            }
             int hits = problem->validate_individual(best_ind);
-            int total_samples = problem->get_num_instances();
+            int total_samples = problem->get_num_samples();
 
             // 3. Costruisci la stringa di report
             ss << "Job # " << job << " :: Evaluations: " << result.first
-                    << " :: Best Fitness: " << result.second
-                    << " :: Runtime (s): " << duration.count();
+                    << " :: Skipped Evaluations: " << this->algorithm->get_skipped_evaluations()
+                    << " :: Best Fitness: " << result.second;
+
+            if (problem->is_batched()) {
+                ss << " :: Full Fitness: " << best_ind->get_fitness();
+            }
+
+            if (this->parameters->is_racing_evaluation()) {
+                ss << " :: Pruned Evaluations: " << this->algorithm->get_pruned_evaluations();
+            }
+
+            if (this->parameters->get_screening_size() > 0) {
+                ss << " :: Screened Evaluations: " << this->algorithm->get_screened_evaluations();
+            }
+
+            // Cache hits are evaluations that have been saved
+            auto fitness_cache = this->algorithm->get_fitness_cache();
+            if (fitness_cache != nullptr) {
+                ss << " :: Cache Hits: " << fitness_cache->get_hits() << "/"
+                   << fitness_cache->get_hits() + fitness_cache->get_misses()
+                   << " (" << fitness_cache->hit_rate() * 100.0 << "%)"
+                   << " :: Cache Entries: " << fitness_cache->size()
+                   << " (" << fitness_cache->memory_usage() / 1024 << " KiB)";
+            }
+
+            ss << " :: Runtime (s): " << duration.count();
+
+            // Share of the concurrent evaluation phases in which each thread was busy
+            auto evaluation_pool = this->algorithm->get_evaluation_pool();
+            if (evaluation_pool != nullptr) {
+                ss << " :: Thread Utilization:";
+                for (double utilization : evaluation_pool->get_utilization()) {
+                    ss << " " << utilization * 100.0 << "%";
+                }
+                ss << " (" << evaluation_pool->get_num_steals() << " steals)";
+            }
 
             // 4. Aggiungi l'accuratezza se disponibile
             if (hits != -1) {
@@ -238,6 +303,14 @@ void Evolver<E, G, F>::execute_job(int job,
                 ss << " :: Accuracy: " << hits << "/" << total_samples 
                    << " (" << accuracy << "%)";
             }
+
+            if (this->validator != nullptr) {
+                int test_samples = this->validator->get_num_samples();
+                ss << " :: Test Accuracy: " << test_result.hits << "/" << test_samples
+                   << " (" << (double) test_result.hits / test_samples * 100.0 << "%)"
+                   << " :: Test Snapshots: " << this->validator->get_num_validated()
+                   << " (" << this->validator->get_num_coalesced() << " coalesced)";
+            }
             
             ss << std::endl;
 		}
@@ -0,0 +1,215 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: FitnessCache.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef FITNESS_FITNESSCACHE_H_
+#define FITNESS_FITNESSCACHE_H_
+
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <mutex>
+
+/// @brief Bounded least-recently-used cache that maps phenotypes to fitness values.
+/// @details An entry is addressed by the canonical hash of the active subgraph of an
+/// individual (see Evaluator::decode_path()) together with the first instance of the
+/// evaluated mini-batch, since fitness values depend on the batch. The entry also holds
+/// the canonical phenotype, which is compared on lookup so that a hash collision cannot
+/// return the fitness of a different phenotype. Individuals with the same phenotype
+/// therefore share one entry. Next to the fitness, an entry holds the number of
+/// correctly classified samples (hits) recorded by the evaluation. All methods are synchronized so that the cache can be
+/// shared by the threads of the evaluation pool.
+/// @tparam F Fitness type
+template<class F>
+class FitnessCache {
+public:
+	// Phenotype hash and first instance of the mini-batch, -1 without mini-batches
+	using Key = std::pair<std::uint64_t, int>;
+
+private:
+	struct Entry {
+		Key key;
+		std::vector<int> phenotype;
+		F fitness;
+		int hits;
+	};
+
+	struct KeyHash {
+		std::size_t operator()(const Key &key) const {
+			return key.first + 0x9e3779b97f4a7c15ULL * (std::uint64_t) (key.second + 1);
+		}
+	};
+
+	std::size_t capacity;
+
+	std::list<Entry> entries;
+	std::unordered_map<Key, typename std::list<Entry>::iterator, KeyHash> index;
+
+	long long hits;
+	long long misses;
+
+	// Bytes held by the phenotypes of the entries
+	std::size_t phenotype_memory;
+
+	mutable std::mutex mutex;
+
+public:
+	FitnessCache(std::size_t p_capacity);
+	virtual ~FitnessCache() = default;
+
+	bool lookup(const Key &key, const std::vector<int> &phenotype, F &fitness,
+			int &hits);
+	void insert(const Key &key, const std::vector<int> &phenotype, F fitness,
+			int hits);
+	void clear();
+
+	long long get_hits() const;
+	long long get_misses() const;
+	double hit_rate() const;
+	std::size_t size() const;
+	std::size_t memory_usage() const;
+};
+
+/// @brief Constructor that sets the maximum number of entries.
+/// @param p_capacity maximum number of entries
+template<class F>
+FitnessCache<F>::FitnessCache(std::size_t p_capacity) {
+
+	if (p_capacity == 0) {
+		throw std::invalid_argument("Fitness cache capacity must be positive!");
+	}
+
+	capacity = p_capacity;
+	hits = 0;
+	misses = 0;
+	phenotype_memory = 0;
+
+	index.reserve(capacity);
+}
+
+/// @brief Looks up the fitness of a phenotype and marks the entry as recently used.
+/// @details Entries whose phenotype differs from the given one are hash collisions
+/// and count as misses.
+/// @param key phenotype hash and batch start
+/// @param phenotype canonical phenotype (see Evaluator::get_phenotype())
+/// @param fitness receives the cached fitness on a hit
+/// @param hits receives the cached number of hits on a hit, -1 if none were recorded
+/// @return true if the phenotype is cached
+template<class F>
+bool FitnessCache<F>::lookup(const Key &key, const std::vector<int> &phenotype,
+		F &fitness, int &hits) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto it = this->index.find(key);
+
+	if (it == this->index.end() || it->second->phenotype != phenotype) {
+		this->misses++;
+		return false;
+	}
+
+	this->entries.splice(this->entries.begin(), this->entries, it->second);
+	fitness = it->second->fitness;
+	hits = it->second->hits;
+	this->hits++;
+
+	return true;
+}
+
+/// @brief Inserts the fitness of a phenotype and evicts the least recently used entry if full.
+/// @details A colliding phenotype replaces the entry of the same key.
+/// @param key phenotype hash and batch start
+/// @param phenotype canonical phenotype (see Evaluator::get_phenotype())
+/// @param fitness fitness of the phenotype
+/// @param hits number of hits of the phenotype, -1 if none were recorded
+template<class F>
+void FitnessCache<F>::insert(const Key &key, const std::vector<int> &phenotype,
+		F fitness, int hits) {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	auto it = this->index.find(key);
+
+	if (it != this->index.end()) {
+		this->phenotype_memory -= it->second->phenotype.size() * sizeof(int);
+		this->phenotype_memory += phenotype.size() * sizeof(int);
+		it->second->phenotype = phenotype;
+		it->second->fitness = fitness;
+		it->second->hits = hits;
+		this->entries.splice(this->entries.begin(), this->entries, it->second);
+		return;
+	}
+
+	if (this->entries.size() >= this->capacity) {
+		this->phenotype_memory -= this->entries.back().phenotype.size() * sizeof(int);
+		this->index.erase(this->entries.back().key);
+		this->entries.pop_back();
+	}
+
+	this->phenotype_memory += phenotype.size() * sizeof(int);
+	this->entries.push_front(Entry { key, phenotype, fitness, hits });
+	this->index[key] = this->entries.begin();
+}
+
+/// @brief Removes all entries and resets the statistics.
+template<class F>
+void FitnessCache<F>::clear() {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	this->entries.clear();
+	this->index.clear();
+	this->phenotype_memory = 0;
+	this->hits = 0;
+	this->misses = 0;
+}
+
+template<class F>
+long long FitnessCache<F>::get_hits() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->hits;
+}
+
+template<class F>
+long long FitnessCache<F>::get_misses() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->misses;
+}
+
+/// @brief Returns the ratio of hits to lookups.
+template<class F>
+double FitnessCache<F>::hit_rate() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	long long lookups = this->hits + this->misses;
+	return lookups > 0 ? (double) this->hits / lookups : 0.0;
+}
+
+template<class F>
+std::size_t FitnessCache<F>::size() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->entries.size();
+}
+
+/// @brief Estimates the memory used by the entries, their phenotypes and the hash index in bytes.
+template<class F>
+std::size_t FitnessCache<F>::memory_usage() const {
+	std::lock_guard<std::mutex> lock(this->mutex);
+
+	std::size_t list_node = sizeof(Entry) + 2 * sizeof(void*);
+	std::size_t index_node = sizeof(Key)
+			+ sizeof(typename std::list<Entry>::iterator) + sizeof(void*);
+
+	return this->entries.size() * (list_node + index_node) + this->phenotype_memory
+			+ this->index.bucket_count() * sizeof(void*);
+}
+
+#endif /* FITNESS_FITNESSCACHE_H_ */
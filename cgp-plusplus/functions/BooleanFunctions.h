@@ -26,10 +26,21 @@
 template<class E>
 class FunctionsBoolean: public Functions<E> {
 public:
+	// Static interface used by the compile-time specialized evaluator (see StaticKernel)
+	static constexpr int ARITY = 2;
+	static constexpr int NUM_FUNCTIONS = 8;
+
+	static E apply(const E inputs[], int function);
+	static void apply_block(const E *const arguments[], E result[], int lanes,
+			int function);
+	static int arity(int function);
+
 	FunctionsBoolean(std::shared_ptr<Parameters> p_parameters);
 	virtual ~FunctionsBoolean() = default;
 
 	E call_function(E inputs[], int function) override;
+	void call_function_block(const E *const arguments[], E result[],
+			int lanes, int function) override;
 	std::string input_name(int input) override;
 	std::string function_name(int function) override;
 
@@ -62,6 +73,12 @@ FunctionsBoolean<E>::FunctionsBoolean(std::shared_ptr<Parameters> p_parameters)
 /// @return result of the function call
 template<class E>
 E FunctionsBoolean<E>::call_function(E inputs[], int function) {
+	return apply(inputs, function);
+}
+
+/// @brief Non-virtual implementation of call_function() that can be inlined.
+template<class E>
+inline E FunctionsBoolean<E>::apply(const E inputs[], int function) {
 
 	E result;
 
@@ -111,6 +128,91 @@ E FunctionsBoolean<E>::call_function(E inputs[], int function) {
 }
 
 
+/// @brief Applies a Boolean function to a block of lanes
+/// @details The block kernel reads two arguments and only knows the functions of this
+/// set, which have at most two arguments. A maximum arity below two and functions added
+/// by derived sets are applied lane by lane (see Functions::call_function_block()).
+/// @param arguments arguments[i] points to the lanes of the i-th argument
+/// @param result lanes of the result
+/// @param lanes number of lanes
+/// @param function index of the function to call
+template<class E>
+void FunctionsBoolean<E>::call_function_block(const E *const arguments[],
+		E result[], int lanes, int function) {
+	if (this->num_operators >= ARITY && function < NUM_FUNCTIONS) {
+		apply_block(arguments, result, lanes, function);
+	} else {
+		Functions<E>::call_function_block(arguments, result, lanes, function);
+	}
+}
+
+/// @brief Block kernel of the Boolean functions
+/// @details Each case is a plain loop over the lanes that the compiler vectorizes
+/// for the instruction set selected at startup (see CGP_TARGET_CLONES).
+template<class E>
+CGP_TARGET_CLONES
+void FunctionsBoolean<E>::apply_block(const E *const arguments[], E result[],
+		int lanes, int function) {
+
+	const E *a = arguments[0];
+	const E *b = arguments[1];
+
+	switch (function) {
+
+	case 0:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] & b[i];
+		}
+		break;
+
+	case 1:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] | b[i];
+		}
+		break;
+
+	case 2:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = ~(a[i] & b[i]);
+		}
+		break;
+
+	case 3:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = ~(a[i] | b[i]);
+		}
+		break;
+
+	case 4:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i];
+		}
+		break;
+
+	case 5:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = ~a[i];
+		}
+		break;
+
+	case 6:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] ^ b[i];
+		}
+		break;
+
+	case 7:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = ~(a[i] ^ b[i]);
+		}
+		break;
+
+	default:
+		throw std::invalid_argument("Illegal function number!");
+
+	}
+}
+
 template<class E>
 std::string FunctionsBoolean<E>::FunctionsBoolean::function_name(int function) {
 
@@ -166,6 +268,12 @@ std::string FunctionsBoolean<E>::input_name(int input) {
 
 template<class E>
 int FunctionsBoolean<E>::arity_of(int function) {
+	return arity(function);
+}
+
+/// @brief Non-virtual implementation of arity_of() that can be inlined.
+template<class E>
+inline int FunctionsBoolean<E>::arity(int function) {
 	switch (function) {
         case 0: // AND
         case 1: // OR
@@ -15,11 +15,22 @@
 
 #include <string>
 #include <any>
+#include <array>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 
 #include "../parameters/Parameters.h"
 
+// Block kernels are compiled for several instruction sets. The dynamic loader 
+// selects the widest one supported by the CPU at startup (AVX-512, AVX2 or the 
+// baseline of the target). Other compilers use the baseline only.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define CGP_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define CGP_TARGET_CLONES
+#endif
+
 /// @brief Abstract base class to represent function set.
 /// @details Ensures that every function set that inherits from this class 
 /// has member fucntions to call the functions and to obtain the function and input names. 
@@ -30,9 +41,15 @@ protected:
 	Functions(std::shared_ptr<Parameters> p_parameters);
 	int num_operators;
 public:
+	// Largest supported maximum arity, bounds the argument buffers of the evaluation
+	static constexpr int MAX_ARITY = 16;
+
 	virtual ~Functions() = default;
 	virtual E call_function(E inputs[], int function) = 0;
 
+	virtual void call_function_block(const E *const arguments[], E result[],
+			int lanes, int function);
+
 	/// @brief Returns the function name 
 	/// @param function index of the functions 
 	/// @return function name
@@ -57,7 +74,35 @@ Functions<E>::Functions(std::shared_ptr<Parameters> p_parameters) {
 		throw std::invalid_argument(
 				"Nullpointer exception in evaluator class!");
 	}
+
+	if (num_operators > MAX_ARITY) {
+		throw std::invalid_argument(
+				"Maximum arity exceeds " + std::to_string(MAX_ARITY) + "!");
+	}
 }
 
+/// @brief Applies a function to a block of lanes, e.g. one lane per problem instance
+/// @details The default calls call_function() for each lane. Function sets override 
+/// it with kernels that process all lanes with vector instructions.
+/// @param arguments arguments[i] points to the lanes of the i-th argument, only the
+/// first arity_of(function) arguments are read
+/// @param result lanes of the result
+/// @param lanes number of lanes
+/// @param function index of the function to call
+template<class E>
+void Functions<E>::call_function_block(const E *const arguments[], E result[],
+		int lanes, int function) {
+
+	std::array<E, MAX_ARITY> inputs;
+	int arity = this->arity_of(function);
+
+	for (int lane = 0; lane < lanes; lane++) {
+		for (int i = 0; i < arity; i++) {
+			inputs[i] = arguments[i][lane];
+		}
+
+		result[lane] = this->call_function(inputs.data(), function);
+	}
+}
 
 #endif /* FUNCTIONS_FUNCTIONS_H_ */
@@ -27,10 +27,21 @@
 template<class E>
 class FunctionsMathematical: public Functions<E>  {
 public:
+		// Static interface used by the compile-time specialized evaluator (see StaticKernel)
+		static constexpr int ARITY = 2;
+		static constexpr int NUM_FUNCTIONS = 4;
+
+		static E apply(const E inputs[], int function);
+		static void apply_block(const E *const arguments[], E result[],
+				int lanes, int function);
+		static int arity(int function);
+
 		FunctionsMathematical(std::shared_ptr<Parameters> p_parameters);
 		virtual ~FunctionsMathematical() = default;
 
 		E call_function(E inputs[], int function) override;
+		void call_function_block(const E *const arguments[], E result[],
+				int lanes, int function) override;
 		std::string input_name(int input) override;
 		std::string function_name(int function) override;
 
@@ -52,6 +63,12 @@ FunctionsMathematical<E>::FunctionsMathematical(std::shared_ptr<Parameters> p_pa
 
 template<class E>
 E FunctionsMathematical<E>::call_function(E inputs[], int function) {
+	return apply(inputs, function);
+}
+
+/// @brief Non-virtual implementation of call_function() that can be inlined.
+template<class E>
+inline E FunctionsMathematical<E>::apply(const E inputs[], int function) {
 
 	E result;
 
@@ -87,6 +104,67 @@ E FunctionsMathematical<E>::call_function(E inputs[], int function) {
 
 }
 
+/// @brief Applies a mathematical function to a block of lanes
+/// @details The block kernel reads two arguments and only knows the functions of this
+/// set, which have at most two arguments. A maximum arity below two and functions added
+/// by derived sets are applied lane by lane (see Functions::call_function_block()).
+/// @param arguments arguments[i] points to the lanes of the i-th argument
+/// @param result lanes of the result
+/// @param lanes number of lanes
+/// @param function index of the function to call
+template<class E>
+void FunctionsMathematical<E>::call_function_block(const E *const arguments[],
+		E result[], int lanes, int function) {
+	if (this->num_operators >= ARITY && function < NUM_FUNCTIONS) {
+		apply_block(arguments, result, lanes, function);
+	} else {
+		Functions<E>::call_function_block(arguments, result, lanes, function);
+	}
+}
+
+/// @brief Block kernel of the mathematical functions
+/// @details The protected division selects the result per lane so that the loop
+/// can be vectorized for the instruction set selected at startup (see CGP_TARGET_CLONES).
+template<class E>
+CGP_TARGET_CLONES
+void FunctionsMathematical<E>::apply_block(const E *const arguments[],
+		E result[], int lanes, int function) {
+
+	const E *a = arguments[0];
+	const E *b = arguments[1];
+
+	switch (function) {
+
+	case 0:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] + b[i];
+		}
+		break;
+
+	case 1:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] - b[i];
+		}
+		break;
+
+	case 2:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = a[i] * b[i];
+		}
+		break;
+
+	case 3:
+		for (int i = 0; i < lanes; i++) {
+			result[i] = b[i] == 0 ? 1 : a[i] / b[i];
+		}
+		break;
+
+	default:
+		throw std::invalid_argument("Illegal function number!");
+
+	}
+}
+
 template<class E>
 std::string FunctionsMathematical<E>::function_name(int function) {
 
@@ -126,6 +204,12 @@ std::string FunctionsMathematical<E>::input_name(int input) {
 
 template<class E>
 int FunctionsMathematical<E>::arity_of(int function) {
+	return arity(function);
+}
+
+/// @brief Non-virtual implementation of arity_of() that can be inlined.
+template<class E>
+inline int FunctionsMathematical<E>::arity(int function) {
 	return 2;
 }
 
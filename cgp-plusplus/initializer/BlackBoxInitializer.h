@@ -22,12 +22,18 @@ protected:
 	std::shared_ptr<std::vector<std::vector<E>> > inputs;
 	std::shared_ptr<std::vector<std::vector<E>> > outputs;
 	int num_instances;
+
+	// Optional held-out test data
+	std::string test_file;
 public:
 	BlackBoxInitializer(const std::string &p_benchmark_file);
 	virtual ~BlackBoxInitializer() = default;
 	virtual void init_problem() = 0;
 	virtual void init_functions() = 0;
 	virtual void read_data();
+	virtual void init_validator();
+
+	void set_test_file(const std::string &p_test_file);
 };
 
 template<class E, class G, class F>
@@ -55,4 +61,21 @@ void BlackBoxInitializer<E, G, F>::read_data() {
 	this->num_instances = bechmark_reader->get_num_instances();
 }
 
+/// @brief Creates the validator for the test file.
+/// @details Problems that support test data override this method. Must be called 
+/// after init_problem() and before init_algorithm().
+template<class E, class G, class F>
+void BlackBoxInitializer<E, G, F>::init_validator() {
+	if (!this->test_file.empty()) {
+		throw std::invalid_argument(
+				"Test data files are not supported for this problem!");
+	}
+}
+
+template<class E, class G, class F>
+void BlackBoxInitializer<E, G, F>::set_test_file(
+		const std::string &p_test_file) {
+	this->test_file = p_test_file;
+}
+
 #endif /* INITIALIZER_BLACKBOXINITIALIZER_H_ */
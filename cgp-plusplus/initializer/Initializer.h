@@ -171,7 +171,31 @@ void Initializer<E, G, F>::init_parfile_parameters(std::string parfile_path) {
 				this->parameters->set_ideal_fitness(value);
 			} else if (parameter == "fixed_layers") {
                 this->parameters->set_fixed_layers(state);
-            } else if (parameter == "minimizing_fitness") {
+            } else if (parameter == "bit_sliced") {
+				this->parameters->set_bit_sliced(state);
+			} else if (parameter == "incremental_evaluation") {
+				this->parameters->set_incremental_evaluation(state);
+			} else if (parameter == "fitness_cache_size") {
+				this->parameters->set_fitness_cache_size(value);
+			} else if (parameter == "racing_evaluation") {
+				this->parameters->set_racing_evaluation(state);
+			} else if (parameter == "racing_instance_order") {
+				this->parameters->set_racing_instance_order(state);
+			} else if (parameter == "batch_size") {
+				this->parameters->set_batch_size(value);
+			} else if (parameter == "batch_interval") {
+				this->parameters->set_batch_interval(value);
+			} else if (parameter == "screening_size") {
+				this->parameters->set_screening_size(value);
+			} else if (parameter == "screening_margin") {
+				this->parameters->set_screening_margin(value);
+			} else if (parameter == "rng_type") {
+				this->parameters->set_rng_type(value);
+			} else if (parameter == "per_gene_mutation") {
+				this->parameters->set_per_gene_mutation(state);
+			} else if (parameter == "parallel_breeding") {
+				this->parameters->set_parallel_breeding(state);
+			} else if (parameter == "minimizing_fitness") {
 				this->parameters->set_minimizing_fitness(state);
 			} else if (parameter == "probabilistic_point_mutation"
 					&& state == true) {
@@ -337,9 +361,9 @@ template<class E, class G, class F>
 void Initializer<E, G, F>::finalize_parameter_configuration() {
 
 	this->parameters->set_genome_size();
-	this->parameters->set_eval_chunk_size();
 	this->parameters->set_population_size(this->parameters->get_num_parents()
 				+ this->parameters->get_num_offspring());
+	this->parameters->set_eval_chunk_size();
 }
 
 /// @brief Inits the number of ERC's according to the predefined type. 
@@ -363,6 +387,9 @@ void Initializer<E, G, F>::init_erc() {
 /// @brief Inits the composite class 
 template<class E, class G, class F>
 void Initializer<E, G, F>::init_composite() {
+	// The genome size depends on the dimensions of the data set by read_data()
+	this->parameters->set_genome_size();
+
 	this->composite = std::make_shared<Composite<E, G, F>>(parameters,
 			functions);
 	this->composite->set_problem(problem);
@@ -403,6 +430,10 @@ void Initializer<E, G, F>::init_checkpoint_file(std::string &checkpoint_file) {
 			this->composite->get_population(), this->composite->get_constants(),
 			this->composite->get_random(), checkpoint_file);
 	this->algorithm->set_generation_number(generation_number);
+
+	// The constants of the checkpoint replace the ones in the input rows of the problem
+	this->composite->get_problem()->update_constants();
+
 	std::cout << "Loaded chekpoint file " << checkpoint_file << std::endl
 			<< std::endl;
 }
@@ -9,82 +9,133 @@
 #include <sstream>
 #include <stdexcept>
 #include <iostream>
+#include <limits>
 
 template<class E, class G, class F>
 class MnistLogicInitializer : public BlackBoxInitializer<E, G, F> {
-public:
-    // Parameter for number of bits per class (e.g., 50)
-    // Total output = 10 classes * 50 bits = 500
-    const int BITS_PER_CLASS = 50; 
-
-    MnistLogicInitializer(const std::string &p_benchmark_file)
-        : BlackBoxInitializer<E, G, F>(p_benchmark_file) {
-    }
-
-    ~MnistLogicInitializer() = default;
+private:
+    // Held-out test data (see init_validator())
+    std::shared_ptr<std::vector<std::vector<E>>> test_inputs;
+    std::shared_ptr<std::vector<std::vector<E>>> test_outputs;
+    int num_test_instances = 0;
 
     /**
-     * @brief Reads the mnist_boolean.txt file generated by Python.
+     * @brief Reads a mnist_boolean.txt file generated by Python.
      * File format:
      * Header: NUM_SAMPLES NUM_INPUTS NUM_CLASSES
      * Rows: LABEL pixel1 pixel2 ... pixel784
+     *
+     * With bit slicing enabled, the dataset is transposed so that one instance
+     * holds as many images as the evaluation type has bits: bit b of input j of
+     * instance w is pixel j of image (w * lanes + b). Every boolean gate then
+     * evaluates all images of a word at once. The output row of an instance
+     * stores the labels of the images packed into it (one per used lane).
+     * @param file Path of the data file.
+     * @param file_inputs Receives the input rows of the instances.
+     * @param file_outputs Receives the labels of the instances.
+     * @param num_inputs_file Receives the number of inputs (pixels).
+     * @param num_classes_file Receives the number of classes.
+     * @return Number of instances.
      */
-    void read_data() override {
-        std::ifstream ifs(this->benchmark_file);
+    int read_file(const std::string &file,
+                  std::shared_ptr<std::vector<std::vector<E>>> &file_inputs,
+                  std::shared_ptr<std::vector<std::vector<E>>> &file_outputs,
+                  int &num_inputs_file, int &num_classes_file) {
+        std::ifstream ifs(file);
         
         if (!ifs.is_open()) {
-            throw std::runtime_error("Could not open MNIST data file: " + this->benchmark_file);
+            throw std::runtime_error("Could not open MNIST data file: " + file);
         }
 
-        int num_samples_file, num_inputs_file, num_classes_file;
+        int num_samples_file;
         
         // 1. Read the header -> check what it does
         if (!(ifs >> num_samples_file >> num_inputs_file >> num_classes_file)) {
             throw std::runtime_error("Error reading MNIST header!");
         }
 
+        // Number of images packed into one word (lane = bit position)
+        int lanes = 1;
+        if (this->parameters->is_bit_sliced()) {
+            lanes = std::numeric_limits<E>::digits;
+        }
+
         std::cout << "Loading MNIST Data..." << std::endl;
         std::cout << "Samples: " << num_samples_file 
                   << ", Inputs: " << num_inputs_file 
-                  << ", Classes: " << num_classes_file << std::endl;
+                  << ", Classes: " << num_classes_file
+                  << ", Images per word: " << lanes << std::endl;
 
-        // 2. for now i set a single batch with all samples
-        this->num_instances = num_samples_file;
-        this->parameters->set_num_variables(num_inputs_file); // 784
-        
-        // Total outputs = Classes * Bits per class (e.g. 10 * 50 = 500)
-        int total_outputs = num_classes_file * BITS_PER_CLASS;
-        this->parameters->set_num_outputs(total_outputs);
+        // 2. All samples are loaded, mini-batches of instances are selected by the problem (see batch_size)
+        int file_instances = (num_samples_file + lanes - 1) / lanes;
 
         // 3. Allocates memory for inputs and outputs
-        this->inputs = std::make_shared<std::vector<std::vector<E>>>(this->num_instances);
-        this->outputs = std::make_shared<std::vector<std::vector<E>>>(this->num_instances);
+        file_inputs = std::make_shared<std::vector<std::vector<E>>>(file_instances,
+                std::vector<E>(num_inputs_file, 0));
+        file_outputs = std::make_shared<std::vector<std::vector<E>>>(file_instances);
 
         // 4. Read the rows (Label + Pixel)
         int label;
         E pixel_val;
 
-        for (int i = 0; i < this->num_instances; ++i) {
+        for (int i = 0; i < num_samples_file; ++i) {
+            int word = i / lanes;
+            int lane = i % lanes;
+            E lane_mask = static_cast<E>(1) << lane;
+
             // A. Read the Label (first column)
             if (!(ifs >> label)) {
                 throw std::runtime_error("Error reading label at line " + std::to_string(i + 1));
             }
 
-            // Save the label as the FIRST element of the output vector.
-            // The MnistLogicProblem will know that outputs[i][0] is the target class.
-            // Resize to 1 just to hold the label (saves memory compared to 500)
-            (*this->outputs)[i].push_back(static_cast<E>(label));
+            // Save the label in the lane slot of the output vector.
+            // The MnistLogicProblem will know that outputs[w][b] is the target class of lane b.
+            (*file_outputs)[word].push_back(static_cast<E>(label));
 
-            // B. Read the Pixels (subsequent columns)
-            (*this->inputs)[i].resize(num_inputs_file);
+            // B. Read the Pixels (subsequent columns) and set the lane bit of each active pixel.
+            // Without bit slicing the pixel values are stored as they are.
+            std::vector<E> &row = (*file_inputs)[word];
             for (int j = 0; j < num_inputs_file; ++j) {
                 ifs >> pixel_val;
-                (*this->inputs)[i][j] = pixel_val;
+                if (lanes == 1) {
+                    row[j] = pixel_val;
+                } else if (pixel_val != 0) {
+                    row[j] |= lane_mask;
+                }
             }
         }
 
         std::cout << "MNIST Data Loaded Successfully." << std::endl;
         ifs.close();
+
+        return file_instances;
+    }
+
+public:
+    // Parameter for number of bits per class (e.g., 50)
+    // Total output = 10 classes * 50 bits = 500
+    const int BITS_PER_CLASS = 50; 
+
+    MnistLogicInitializer(const std::string &p_benchmark_file)
+        : BlackBoxInitializer<E, G, F>(p_benchmark_file) {
+    }
+
+    ~MnistLogicInitializer() = default;
+
+    /**
+     * @brief Reads the training data (see read_file()).
+     */
+    void read_data() override {
+        int num_inputs_file, num_classes_file;
+
+        this->num_instances = this->read_file(this->benchmark_file, this->inputs,
+                this->outputs, num_inputs_file, num_classes_file);
+
+        this->parameters->set_num_variables(num_inputs_file); // 784
+        
+        // Total outputs = Classes * Bits per class (e.g. 10 * 50 = 500)
+        int total_outputs = num_classes_file * BITS_PER_CLASS;
+        this->parameters->set_num_outputs(total_outputs);
     }
 
     /**
@@ -120,6 +171,40 @@ public:
         // REGISTRATION IN THE COMPOSITE (check what it does)
         this->composite->set_problem(this->problem);
     }
+
+    /**
+     * @brief Reads the test file and creates the background validator.
+     * @details The test problem gets its own evaluator so that the validator thread
+     * does not share scratch space with the evolution.
+     */
+    void init_validator() override {
+        if (this->test_file.empty()) {
+            return;
+        }
+
+        int num_inputs_file, num_classes_file;
+
+        this->num_test_instances = this->read_file(this->test_file, this->test_inputs,
+                this->test_outputs, num_inputs_file, num_classes_file);
+
+        if (num_inputs_file != this->parameters->get_num_variables()
+                || num_classes_file * BITS_PER_CLASS != this->parameters->get_num_outputs()) {
+            throw std::invalid_argument("Test data does not match the training data!");
+        }
+
+        std::shared_ptr<MnistLogicProblem<E, G, F>> test_problem =
+                std::make_shared<MnistLogicProblem<E, G, F>>(
+                    this->parameters,
+                    std::make_shared<Evaluator<E, G, F>>(*this->evaluator),
+                    this->test_inputs,
+                    this->test_outputs,
+                    this->constants,
+                    this->num_test_instances
+                );
+
+        this->composite->set_validator(
+                std::make_shared<TestValidator<E, G, F>>(test_problem));
+    }
 };
 
 #endif /* INITIALIZER_MNISTLOGICINITIALIZER_H_ */
\ No newline at end of file
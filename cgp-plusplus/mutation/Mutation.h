@@ -42,7 +42,7 @@ public:
 			std::shared_ptr<Random> p_random,
 			std::shared_ptr<Species<G>> p_species);
 	virtual ~Mutation() = default;
-	void mutate(std::shared_ptr<Individual<G, F>> parent);
+	MutationReport mutate(const std::shared_ptr<Individual<G, F>> &parent);
 	void print();
 	const std::shared_ptr<MutationPipeline<G, F> >& get_pipeline() const;
 	void set_pipeline(const std::shared_ptr<MutationPipeline<G, F> > &pipeline);
@@ -84,9 +84,10 @@ Mutation<G, F>::Mutation(std::shared_ptr<Parameters> p_parameters,
 
 /// @brief Triggers the variation process of the configured mutation pipeline.  
 /// @param parent selected parent individual 
+/// @return report of the genes changed by the pipeline
 template<class G, class F>
-void Mutation<G, F>::mutate(std::shared_ptr<Individual<G, F>> parent) {
-	this->pipeline->breed(parent);
+MutationReport Mutation<G, F>::mutate(const std::shared_ptr<Individual<G, F>> &parent) {
+	return this->pipeline->breed(parent);
 }
 
 template<class G, class F>
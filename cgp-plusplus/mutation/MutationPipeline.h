@@ -23,6 +23,7 @@
 #include "../variation/mutation/Inversion.h"
 #include "../variation/mutation/ProbabilisticPoint.h"
 #include "../variation/mutation/SingleActiveGene.h"
+#include "MutationReport.h"
 
 /// @brief Class to represent the mutation pipeline 
 /// @details Pipelining is established by using a vector that is iterated
@@ -40,6 +41,10 @@ private:
 	std::shared_ptr<Random> random;
 	std::shared_ptr<Species<G>> species;
 
+	// Scratch space to detect the changed genes
+	std::vector<G> genome_before;
+	std::vector<char> active_flags;
+
 public:
 
 	MutationPipeline(std::shared_ptr<Parameters> p_parameters,
@@ -48,7 +53,7 @@ public:
 	virtual ~MutationPipeline() = default;
 
 	void init();
-	void breed(std::shared_ptr<Individual<G, F>> ind);
+	MutationReport breed(const std::shared_ptr<Individual<G, F>> &ind);
 	void print();
 
 };
@@ -77,6 +82,10 @@ MutationPipeline<G, F>::MutationPipeline(
 	pipeline = std::make_shared<
 			std::vector<std::shared_ptr<UnaryOperator<G, F>>>>();
 
+	genome_before.resize(p_parameters->get_genome_size());
+	active_flags.resize(p_parameters->get_num_inputs()
+			+ p_parameters->get_num_function_nodes());
+
 	this->init();
 
 }
@@ -127,12 +136,53 @@ void MutationPipeline<G, F>::print() {
 }
 
 /// @brief Performs the breeding procedure 
-/// @details Iterates over the pipeline and calls the varation method 
+/// @details Iterates over the pipeline and calls the varation method. Afterwards the 
+/// genome is compared to the genome before the variation to report the changed genes. 
+/// The active nodes of the individual must belong to the genome before the variation.
+/// @param ind individual to mutate
+/// @return report of the changed genes
 template<class G, class F>
-void MutationPipeline<G, F>::breed(std::shared_ptr<Individual<G, F>> ind) {
+MutationReport MutationPipeline<G, F>::breed(const std::shared_ptr<Individual<G, F>> &ind) {
+
+	MutationReport report;
+
+	const G *genome = ind->get_genome().get();
+	int genome_size = this->genome_before.size();
+
+	std::copy(genome, genome + genome_size,
+			this->genome_before.begin());
+
 	for (auto it = this->pipeline->begin(); it != this->pipeline->end(); ++it) {
 		it->get()->variate(ind);
 	}
+
+	std::shared_ptr<std::vector<int>> active_nodes = ind->get_active_nodes();
+
+	for (int node_num : *active_nodes) {
+		this->active_flags[node_num] = 1;
+	}
+
+	for (int position = 0; position < genome_size; position++) {
+		if (genome[position] == this->genome_before[position]) {
+			continue;
+		}
+
+		report.changed_genes.push_back(position);
+
+		if (this->species->decode_genotype_at(position)
+				== this->species->OUTPUT_GENE) {
+			report.output_changed = true;
+		} else if (this->active_flags[this->species->node_number_from_position(
+				position)]) {
+			report.active_changed = true;
+		}
+	}
+
+	for (int node_num : *active_nodes) {
+		this->active_flags[node_num] = 0;
+	}
+
+	return report;
 }
 
 
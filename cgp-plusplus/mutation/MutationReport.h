@@ -0,0 +1,34 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: MutationReport.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef MUTATION_MUTATIONREPORT_H_
+#define MUTATION_MUTATIONREPORT_H_
+
+#include <vector>
+
+/// @brief Summary of the genes that have been changed by the mutation pipeline.
+/// @details Genes belong to the active part of the genome if they are genes of an
+/// active function node or output genes. Offspring without such changes have the
+/// same phenotype as their parent and don't need to be evaluated.
+struct MutationReport {
+	std::vector<int> changed_genes;
+
+	bool active_changed = false;
+	bool output_changed = false;
+
+	/// @brief Returns whether the phenotype might differ from the parent.
+	bool is_phenotype_changed() const {
+		return this->active_changed || this->output_changed;
+	}
+};
+
+#endif /* MUTATION_MUTATIONREPORT_H_ */
@@ -47,6 +47,18 @@ Parameters::Parameters() {
 
 	neutral_genetic_drift = true;
 	fixed_layers = false;
+	bit_sliced = false;
+	incremental_evaluation = false;
+	fitness_cache_size = 0;
+	racing_evaluation = false;
+	racing_instance_order = false;
+	batch_size = 0;
+	batch_interval = 1;
+	screening_size = 0;
+	screening_margin = 0.05;
+	rng_type = MERSENNE_TWISTER;
+	per_gene_mutation = false;
+	parallel_breeding = false;
 
 	evaluate_expression = false;
 	minimizing_fitness = true;
@@ -529,6 +541,102 @@ void Parameters::set_fixed_layers(bool p_fixed_layers) {
     this->fixed_layers = p_fixed_layers;
 }
 
+bool Parameters::is_bit_sliced() const {
+	return this->bit_sliced;
+}
+
+void Parameters::set_bit_sliced(bool p_bit_sliced) {
+	this->bit_sliced = p_bit_sliced;
+}
+
+bool Parameters::is_incremental_evaluation() const {
+	return this->incremental_evaluation;
+}
+
+void Parameters::set_incremental_evaluation(bool p_incremental_evaluation) {
+	this->incremental_evaluation = p_incremental_evaluation;
+}
+
+int Parameters::get_fitness_cache_size() const {
+	return this->fitness_cache_size;
+}
+
+void Parameters::set_fitness_cache_size(int p_fitness_cache_size) {
+	this->fitness_cache_size = p_fitness_cache_size;
+}
+
+bool Parameters::is_racing_evaluation() const {
+	return this->racing_evaluation;
+}
+
+void Parameters::set_racing_evaluation(bool p_racing_evaluation) {
+	this->racing_evaluation = p_racing_evaluation;
+}
+
+bool Parameters::is_racing_instance_order() const {
+	return this->racing_instance_order;
+}
+
+void Parameters::set_racing_instance_order(bool p_racing_instance_order) {
+	this->racing_instance_order = p_racing_instance_order;
+}
+
+int Parameters::get_batch_size() const {
+	return this->batch_size;
+}
+
+void Parameters::set_batch_size(int p_batch_size) {
+	this->batch_size = p_batch_size;
+}
+
+int Parameters::get_batch_interval() const {
+	return this->batch_interval;
+}
+
+void Parameters::set_batch_interval(int p_batch_interval) {
+	this->batch_interval = p_batch_interval;
+}
+
+int Parameters::get_screening_size() const {
+	return this->screening_size;
+}
+
+void Parameters::set_screening_size(int p_screening_size) {
+	this->screening_size = p_screening_size;
+}
+
+float Parameters::get_screening_margin() const {
+	return this->screening_margin;
+}
+
+void Parameters::set_screening_margin(float p_screening_margin) {
+	this->screening_margin = p_screening_margin;
+}
+
+RNG_TYPE Parameters::get_rng_type() const {
+	return this->rng_type;
+}
+
+void Parameters::set_rng_type(RNG_TYPE p_rng_type) {
+	this->rng_type = p_rng_type;
+}
+
+bool Parameters::is_per_gene_mutation() const {
+	return this->per_gene_mutation;
+}
+
+void Parameters::set_per_gene_mutation(bool p_per_gene_mutation) {
+	this->per_gene_mutation = p_per_gene_mutation;
+}
+
+bool Parameters::is_parallel_breeding() const {
+	return this->parallel_breeding;
+}
+
+void Parameters::set_parallel_breeding(bool p_parallel_breeding) {
+	this->parallel_breeding = p_parallel_breeding;
+}
+
 PROBLEM Parameters::get_problem() const {
 	return problem;
 }
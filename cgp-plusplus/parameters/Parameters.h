@@ -18,6 +18,7 @@ typedef unsigned int MUTATION_TYPE;
 typedef unsigned int CROSSOVER_TYPE;
 typedef unsigned int ALGORITHM;
 typedef unsigned int PROBLEM;
+typedef unsigned int RNG_TYPE;
 
 #include <stdexcept>
 #include <iostream>
@@ -51,6 +52,9 @@ public:
 	const PROBLEM SYMBOLIC_REGRESSION = 0;
 	const PROBLEM LOGIC_SYNTHESIS = 1;
 
+	const RNG_TYPE MERSENNE_TWISTER = 0;
+	const RNG_TYPE XOSHIRO256 = 1;
+
 	const std::string STAT_FILE_DIR = "data/statfiles/";
 	const std::string CHECKPOINT_FILE_DIR = "data/checkpoints/";
 
@@ -105,6 +109,23 @@ private:
 
 	bool neutral_genetic_drift;
 	bool fixed_layers;
+	bool bit_sliced;
+	bool incremental_evaluation;
+
+	int fitness_cache_size;
+
+	bool racing_evaluation;
+	bool racing_instance_order;
+
+	int batch_size;
+	int batch_interval;
+
+	int screening_size;
+	float screening_margin;
+
+	RNG_TYPE rng_type;
+	bool per_gene_mutation;
+	bool parallel_breeding;
 
 	bool evaluate_expression;
 	bool minimizing_fitness;
@@ -201,6 +222,42 @@ public:
 	bool is_fixed_layers() const;
     void set_fixed_layers(bool p_fixed_layers); //MODIFICATO
 
+	bool is_bit_sliced() const;
+	void set_bit_sliced(bool p_bit_sliced);
+
+	bool is_incremental_evaluation() const;
+	void set_incremental_evaluation(bool p_incremental_evaluation);
+
+	int get_fitness_cache_size() const;
+	void set_fitness_cache_size(int p_fitness_cache_size);
+
+	bool is_racing_evaluation() const;
+	void set_racing_evaluation(bool p_racing_evaluation);
+
+	bool is_racing_instance_order() const;
+	void set_racing_instance_order(bool p_racing_instance_order);
+
+	int get_batch_size() const;
+	void set_batch_size(int p_batch_size);
+
+	int get_batch_interval() const;
+	void set_batch_interval(int p_batch_interval);
+
+	int get_screening_size() const;
+	void set_screening_size(int p_screening_size);
+
+	float get_screening_margin() const;
+	void set_screening_margin(float p_screening_margin);
+
+	RNG_TYPE get_rng_type() const;
+	void set_rng_type(RNG_TYPE p_rng_type);
+
+	bool is_per_gene_mutation() const;
+	void set_per_gene_mutation(bool p_per_gene_mutation);
+
+	bool is_parallel_breeding() const;
+	void set_parallel_breeding(bool p_parallel_breeding);
+
 	bool is_minimizing_fitness() const;
 	void set_minimizing_fitness(bool p_miniming_fitness);
 
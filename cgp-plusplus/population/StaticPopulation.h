@@ -74,11 +74,15 @@ void StaticPopulation<G, F>::reset() {
 
 /// @brief Initializes the population by instantiating the individuals
 /// that are reference by a shared pointer 
+/// @details The individuals share the gene table of the first one.
 template<class G, class F>
 void StaticPopulation<G, F>::init() {
+	std::shared_ptr<const typename Species<G>::GeneTable> gene_table;
+
 	for (int i = 0; i < this->population_size; i++) {
 		std::shared_ptr<Individual<G, F>> ind = std::make_shared<
-				Individual<G, F>>(this->random, this->parameters);
+				Individual<G, F>>(this->random, this->parameters, gene_table);
+		gene_table = ind->get_gene_table();
 		this->individuals[i] = ind;
 	}
 }
@@ -113,7 +117,7 @@ void StaticPopulation<G, F>::init_from_checkpoint(
 	for (int i = 0; i < this->population_size; i++) {
 
 		std::vector<std::string>& genome_vec = genomes->at(i);
-		std::shared_ptr<G[]> genome(new G[size](), std::default_delete<G[]>());
+		std::vector<G> genome(size);
 
 		for (int j = 0; j < size; j++) {
 			std::string s = genome_vec.at(j);
@@ -123,16 +127,20 @@ void StaticPopulation<G, F>::init_from_checkpoint(
 				genome[j] = std::stof(s);
 			}
 		}
-		this->individuals[i]->set_genome(genome);
+		this->individuals[i]->copy_genome(genome.data());
 	}
 }
 
 /// @brief Sorts the population on this basis of the respective fitness
-/// @details Uses lambda a lambda function for the comparison
+/// @details Uses lambda a lambda function for the comparison. Individuals that have
+/// been rejected by the screening are placed behind the fully evaluated ones.
 template<class G, class F>
 void StaticPopulation<G, F>::sort() {
 std::sort(this->individuals.get(), this->individuals.get() + this->size(),
 		[](auto const ind1, auto const ind2) {
+			if (ind1->is_screened() != ind2->is_screened()) {
+				return ind2->is_screened();
+			}
 			return ind1->get_fitness() < ind2->get_fitness();
 		});
 }
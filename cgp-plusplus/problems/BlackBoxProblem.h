@@ -16,13 +16,17 @@
 
 #include <stdexcept>
 #include <memory>
-#include <mutex>
+#include <limits>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
 
 #include "../parameters/Parameters.h"
 #include "../evaluator/Evaluator.h"
+#include "../evaluator/NodeCache.h"
+#include "../fitness/FitnessCache.h"
 #include "../representation/Individual.h"
-
-std::mutex mtx;
+#include "MiniBatch.h"
 
 /// @brief Base class to represent a black box problem.
 /// @details Provides core functionality for the evaluation of the black box problem. 
@@ -35,13 +39,60 @@ protected:
 	std::shared_ptr<Parameters> parameters;
 	std::shared_ptr<Evaluator<E, G, F>> evaluator;
 
-	std::shared_ptr<std::vector<std::vector<E>>> inputs;
-	std::shared_ptr<std::vector<std::vector<E>>> outputs;
+	// Problem data is shared between clones. The input rows are stored instance-major
+	// in one buffer, each row holds the variables followed by the constants.
+	std::shared_ptr<std::vector<E>> input_rows;
+	std::shared_ptr<const std::vector<std::vector<E>>> outputs;
 
 	std::shared_ptr<std::vector<E>> constants;
 
+	// Outputs of the individual for one instance, reused for every instance
 	std::shared_ptr<std::vector<E>> outputs_individual;
 
+	const E* input_row(int instance) const;
+
+	// Fitness of previously evaluated phenotypes, shared between clones
+	std::shared_ptr<FitnessCache<F>> fitness_cache;
+
+	bool lookup_fitness(const std::shared_ptr<Individual<G, F>> &individual);
+	void store_fitness(const std::shared_ptr<Individual<G, F>> &individual);
+	typename FitnessCache<F>::Key fitness_key(
+			const std::shared_ptr<Individual<G, F>> &individual) const;
+
+	// Mini-batch of instances that replaces the dataset during the evaluation,
+	// nullptr if all instances are evaluated. Shared between clones.
+	std::shared_ptr<MiniBatch> batch;
+
+	int num_batch_instances() const;
+
+	// Number of instances on which offspring are screened (see screen_individual())
+	int screening_size = 0;
+
+	// Racing: evaluation order of the instances and the number of aborts
+	// caused by each instance, shared between clones
+	bool racing;
+	std::shared_ptr<std::vector<int>> instance_order;
+	std::shared_ptr<std::vector<std::atomic<long long>>> instance_aborts;
+
+	F racing_bound() const;
+	int instance_at(int position) const;
+
+	// Errors of the instances of the most recent block
+	std::vector<F> block_errors;
+
+	// Correctly classified samples of the running evaluation, counted in evaluate() 
+	// by problems that set counting_hits and recorded in the individual unless a
+	// mini-batch is evaluated
+	bool counting_hits = false;
+	int hits = 0;
+
+	void load_instance(int instance, int lane, E *registers);
+	virtual void load_block(int start, int lanes, E *registers);
+	virtual void evaluate_block(const Program &program, const E *registers,
+			int start, int lanes, F errors[]);
+	bool race(const std::shared_ptr<Individual<G, F>> &individual, F diff,
+			F &remaining, int instance, F bound);
+
 	std::string name;
 
 	int num_variables;
@@ -53,36 +104,89 @@ protected:
 public:
 	BlackBoxProblem(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
-			std::shared_ptr<std::vector<E>> p_constants);
+			const std::shared_ptr<std::vector<E>> &p_constants);
 
 	BlackBoxProblem(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
-			std::shared_ptr<std::vector<E>> p_constants, int p_num_instances);
+			const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances);
 
 	BlackBoxProblem(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
 			std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 			std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-			std::shared_ptr<std::vector<E>> p_constants, int p_num_instances);
+			const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances);
 
 	BlackBoxProblem(const BlackBoxProblem &problem);
 
 	virtual void evaluate_individual(
-				std::shared_ptr<Individual<G, F>> individual);
+				const std::shared_ptr<Individual<G, F>> &individual,
+				F bound = std::numeric_limits<F>::max());
+	virtual void evaluate_incremental(
+				const std::shared_ptr<Individual<G, F>> &individual,
+				const NodeCache<E, G, F> &cache, NodeOverlay<E> &overlay,
+				F bound = std::numeric_limits<F>::max());
+	void cache_individual(const std::shared_ptr<Individual<G, F>> &individual,
+			NodeCache<E, G, F> &cache);
+
+	void set_fitness_cache(std::shared_ptr<FitnessCache<F>> p_fitness_cache);
+	void update_constants();
+
+	virtual void init_batches(int size);
+	void next_batch();
+	bool is_batched() const;
+	std::shared_ptr<Individual<G, F>> evaluate_full(
+			const std::shared_ptr<Individual<G, F>> &individual);
+	double evaluation_cost(
+			const std::shared_ptr<Individual<G, F>> &individual) const;
+
+	void set_screening_size(int p_screening_size);
+	F screen_individual(const std::shared_ptr<Individual<G, F>> &individual);
 
 	virtual BlackBoxProblem<E, G, F>* clone() = 0;
-	virtual F evaluate(std::shared_ptr<std::vector<E>> outputs_real,
-			std::shared_ptr<std::vector<E>> outputs_individual) = 0;
+	virtual F evaluate(const std::vector<E> &outputs_real,
+			const std::vector<E> &outputs_individual) = 0;
 	const std::string& get_name() const;
 
 	int get_num_instances() const {
         return this->num_instances;
     }
 
-	virtual int validate_individual(std::shared_ptr<Individual<G, F>> individual) {
+	/// @brief Returns the number of samples covered by the instances.
+	/// @details Equals the number of instances unless a problem packs several
+	/// samples into one instance (e.g. bit-sliced MNIST).
+	virtual int get_num_samples() const {
+		return this->num_instances;
+	}
+
+	virtual int validate_individual(const std::shared_ptr<Individual<G, F>> &individual) {
         return -1; 
     }
 
+	/// @brief Returns the number of classes of classification problems, 0 otherwise.
+	virtual int get_num_classes() const {
+		return 0;
+	}
+
+	/// @brief Counts the correctly classified samples and fills the confusion matrix.
+	/// @details Used for the validation on test data (see TestValidator).
+	/// @param individual decoded individual
+	/// @param confusion receives the counts, confusion[label * num_classes + prediction]
+	/// @return number of correctly classified samples, -1 if not supported
+	virtual int classify_individual(const std::shared_ptr<Individual<G, F>> &individual,
+			std::vector<long long> &confusion) {
+		return -1;
+	}
+
+	/// @brief Returns the lowest value that evaluate() can return for an instance.
+	/// @details Used by racing to bound the error of the instances that have not
+	/// been evaluated yet. The default assumes non-negative errors.
+	/// @param instance index of the instance
+	virtual F instance_lower_bound(int instance) const {
+		return 0;
+	}
+
+	void update_instance_order();
+
 	virtual ~BlackBoxProblem() = default;
 };
 
@@ -96,7 +200,7 @@ template<class E, class G, class F>
 BlackBoxProblem<E, G, F>::BlackBoxProblem(
 		std::shared_ptr<Parameters> p_parameters,
 		std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
-		std::shared_ptr<std::vector<E>> p_constants, int p_num_instances) {
+		const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances) {
 
 	if (p_parameters != nullptr && p_evaluator != nullptr
 			&& p_constants != nullptr) {
@@ -115,11 +219,23 @@ BlackBoxProblem<E, G, F>::BlackBoxProblem(
 
 	num_instances = p_num_instances;
 
-	inputs = std::make_shared<std::vector<std::vector<E>>>(num_instances);
-	outputs = std::make_shared<std::vector<std::vector<E>>>(num_instances);
+	input_rows = std::make_shared<std::vector<E>>(
+			(size_t) num_instances * num_inputs);
+	outputs = std::make_shared<const std::vector<std::vector<E>>>(num_instances);
 
 	outputs_individual = std::make_shared<std::vector<E>>(num_outputs);
 
+	// Racing only prunes minimizing problems
+	racing = parameters->is_racing_evaluation()
+			&& parameters->is_minimizing_fitness();
+
+	if (racing && parameters->is_racing_instance_order()) {
+		instance_order = std::make_shared<std::vector<int>>(num_instances);
+		std::iota(instance_order->begin(), instance_order->end(), 0);
+
+		instance_aborts = std::make_shared<std::vector<std::atomic<long long>>>(
+				num_instances);
+	}
 }
 
 /// @brief Overloaded constructor that initializes the input/output vectors
@@ -135,7 +251,7 @@ BlackBoxProblem<E, G, F>::BlackBoxProblem(
 		std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
 		std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 		std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-		std::shared_ptr<std::vector<E>> p_constants, int p_num_instances) :
+		const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances) :
 		BlackBoxProblem<E, G, F>(p_parameters, p_evaluator, p_constants,
 				p_num_instances) {
 
@@ -149,29 +265,36 @@ BlackBoxProblem<E, G, F>::BlackBoxProblem(
 		throw std::invalid_argument("Empty vector in BlackBoxProblem class!");
 	}
 
-	E value;
+	auto outputs_data = std::make_shared<std::vector<std::vector<E>>>(
+			this->num_instances);
 
 	for (int i = 0; i < this->num_instances; i++) {
+		E *row = this->input_rows->data() + (size_t) i * this->num_inputs;
+
 		for (int j = 0; j < this->num_variables; j++) {
-			value = (*p_inputs)[i][j];
-			this->inputs->at(i).push_back(value);
+			row[j] = (*p_inputs)[i][j];
 		}
 
-		for (int j = 0; j < this->num_outputs; j++) {
-			value = (*p_outputs)[i][j];
-			this->outputs->at(i).push_back(value);
-		}
+		// The output rows are copied as they are since their width is
+		// defined by the problem (e.g. class labels for MNIST)
+		outputs_data->at(i) = (*p_outputs)[i];
 	}
 
+	this->outputs = outputs_data;
+
+	this->update_constants();
 }
 
-/// @brief Copy constructor for deep cloning 
+/// @brief Copy constructor for cloning 
+/// @details The clone receives its own evaluator so that clones can evaluate
+/// individuals concurrently without sharing the evaluator's internal state.
+/// The immutable problem data and the constants are shared with the original.
 /// @param problem problem instance to clone
 template<class E, class G, class F>
 BlackBoxProblem<E, G, F>::BlackBoxProblem(const BlackBoxProblem &problem) {
 
 	parameters = problem.parameters;
-	evaluator = problem.evaluator;
+	evaluator = std::make_shared<Evaluator<E, G, F>>(*problem.evaluator);
 
 	num_variables = problem.num_variables;
 	num_constants = problem.num_constants;
@@ -180,10 +303,21 @@ BlackBoxProblem<E, G, F>::BlackBoxProblem(const BlackBoxProblem &problem) {
 	num_outputs = problem.num_outputs;
 	num_instances = problem.num_instances;
 
-	inputs = std::make_shared<std::vector<std::vector<E>>>(*problem.inputs);
-	outputs = std::make_shared<std::vector<std::vector<E>>>(*problem.outputs);
+	input_rows = problem.input_rows;
+	outputs = problem.outputs;
+
+	constants = problem.constants;
+
+	fitness_cache = problem.fitness_cache;
+
+	racing = problem.racing;
+	instance_order = problem.instance_order;
+	instance_aborts = problem.instance_aborts;
 
-	constants = std::make_shared<std::vector<E>>(*problem.constants);
+	batch = problem.batch;
+	screening_size = problem.screening_size;
+
+	counting_hits = problem.counting_hits;
 
 	outputs_individual = std::make_shared<std::vector<E>>(num_outputs);
 }
@@ -193,46 +327,586 @@ const std::string& BlackBoxProblem<E, G, F>::get_name() const {
 	return this->name;
 }
 
+/// @brief Sets the fitness cache that is consulted before an individual is evaluated
+/// @details Clones that are created afterwards share the cache.
+/// @param p_fitness_cache shared pointer to fitness cache, nullptr disables caching
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::set_fitness_cache(
+		std::shared_ptr<FitnessCache<F>> p_fitness_cache) {
+	this->fitness_cache = p_fitness_cache;
+}
+
+/// @brief Writes the constants to the input rows of all instances
+/// @details Has to be called if the constants change after the problem has been
+/// created (e.g. when they are loaded from a checkpoint). Clones share the rows.
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::update_constants() {
+	for (int i = 0; i < this->num_instances; i++) {
+		E *row = this->input_rows->data() + (size_t) i * this->num_inputs;
+
+		for (int j = 0; j < this->num_constants; j++) {
+			row[this->num_variables + j] = (*this->constants)[j];
+		}
+	}
+}
+
+/// @brief Returns the input row of an instance (variables followed by constants)
+template<class E, class G, class F>
+const E* BlackBoxProblem<E, G, F>::input_row(int instance) const {
+	return this->input_rows->data() + (size_t) instance * this->num_inputs;
+}
+
+/// @brief Restricts the evaluation to mini-batches of instances.
+/// @details Must be called before the problem is cloned, so that the clones share
+/// the batch. Sizes that cover the whole dataset disable the mini-batches.
+/// @param size number of instances per batch, 0 evaluates all instances
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::init_batches(int size) {
+	if (size <= 0 || size >= this->num_instances) {
+		this->batch = nullptr;
+	} else {
+		this->batch = std::make_shared<MiniBatch>(size, this->num_instances);
+	}
+}
+
+/// @brief Moves the evaluation to the next mini-batch.
+/// @details Must not be called during evaluation. Fitness values of the previous
+/// batch are not comparable to the following ones.
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::next_batch() {
+	if (this->batch != nullptr) {
+		this->batch->advance(this->num_instances);
+	}
+}
+
+template<class E, class G, class F>
+bool BlackBoxProblem<E, G, F>::is_batched() const {
+	return this->batch != nullptr;
+}
+
+/// @brief Returns the number of instances that are evaluated per individual
+template<class E, class G, class F>
+int BlackBoxProblem<E, G, F>::num_batch_instances() const {
+	if (this->batch != nullptr) {
+		return this->batch->instances.size();
+	}
+	return this->num_instances;
+}
+
+/// @brief Evaluates a copy of an individual on all instances of the dataset
+/// @details Used to report the fitness of individuals that have been evaluated on a
+/// mini-batch. Must not be called during evaluation.
+/// @param individual individual to evaluate
+/// @return evaluated copy of the individual
+template<class E, class G, class F>
+std::shared_ptr<Individual<G, F>> BlackBoxProblem<E, G, F>::evaluate_full(
+		const std::shared_ptr<Individual<G, F>> &individual) {
+
+	std::shared_ptr<Individual<G, F>> full = std::make_shared<Individual<G, F>>(
+			individual);
+	full->set_evaluated(false);
+
+	// The batch is restored afterwards, std::move leaves it empty
+	std::shared_ptr<MiniBatch> current = std::move(this->batch);
+
+	this->evaluate_individual(full);
+
+	this->batch = current;
+
+	return full;
+}
+
+/// @brief Estimates the cost of the evaluation of an individual for the scheduling.
+/// @details The cost is the number of active nodes times the number of evaluated
+/// instances. Offspring inherit the active nodes of their parent, which serve as
+/// estimate until they are decoded. Individuals that have not been decoded yet are
+/// assumed to use all function nodes.
+/// @param individual individual to evaluate
+/// @return estimated cost, 0 if the individual has been evaluated
+template<class E, class G, class F>
+double BlackBoxProblem<E, G, F>::evaluation_cost(
+		const std::shared_ptr<Individual<G, F>> &individual) const {
+
+	if (individual->is_evaluated()) {
+		return 0.0;
+	}
+
+	double num_nodes = individual->get_active_nodes()->size();
+
+	if (num_nodes == 0) {
+		num_nodes = this->parameters->get_num_function_nodes();
+	}
+
+	return num_nodes * this->num_batch_instances();
+}
+
+/// @brief Sets the number of instances on which individuals are screened
+/// @details Must be called before the problem is cloned.
+/// @param p_screening_size number of screening instances
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::set_screening_size(int p_screening_size) {
+	if (p_screening_size <= 0) {
+		throw std::invalid_argument("Screening size must be positive!");
+	}
+	this->screening_size = p_screening_size;
+}
+
+/// @brief Evaluates an individual on the screening instances
+/// @details The screening instances are spread evenly over the evaluated instances
+/// (the dataset or the current mini-batch) and do not follow the racing order.
+/// The result is a cheap estimate that is only comparable to the screening 
+/// fitness of other individuals. The individual itself is only decoded.
+/// @param individual individual to screen
+/// @return summed error of the screening instances
+template<class E, class G, class F>
+F BlackBoxProblem<E, G, F>::screen_individual(
+		const std::shared_ptr<Individual<G, F>> &individual) {
+
+	this->evaluator->decode_path(individual);
+
+	const Program &program = this->evaluator->compile(individual);
+
+	E *registers = this->evaluator->get_block_registers();
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	int num_evaluated = this->num_batch_instances();
+	int num_screened = std::min(this->screening_size, num_evaluated);
+
+	std::vector<E> &outputs_ind = *this->outputs_individual;
+	int num_outputs = program.outputs.size();
+	outputs_ind.resize(num_outputs);
+
+	std::vector<int> instances(std::min(block_lanes, num_screened));
+	F diff = 0;
+
+	for (int start = 0; start < num_screened; start += block_lanes) {
+		int lanes = std::min(block_lanes, num_screened - start);
+
+		for (int lane = 0; lane < lanes; lane++) {
+			int position = (int) ((long long) (start + lane) * num_evaluated
+					/ num_screened);
+			instances[lane] = this->batch != nullptr ?
+					this->batch->instances[position] : position;
+
+			this->load_instance(instances[lane], lane, registers);
+		}
+
+		this->evaluator->execute_block(program, lanes);
+
+		for (int lane = 0; lane < lanes; lane++) {
+			for (int k = 0; k < num_outputs; k++) {
+				outputs_ind[k] = registers[program.outputs[k] * block_lanes + lane];
+			}
+
+			diff += this->evaluate(this->outputs->at(instances[lane]),
+					outputs_ind);
+		}
+	}
+
+	return diff;
+}
+
+/// @brief Returns the fitness cache key of a decoded individual
+/// @details Fitness values depend on the mini-batch, so the phenotype hash is 
+/// paired with the first instance of the batch.
+template<class E, class G, class F>
+typename FitnessCache<F>::Key BlackBoxProblem<E, G, F>::fitness_key(
+		const std::shared_ptr<Individual<G, F>> &individual) const {
+
+	int batch_start = this->batch != nullptr ? this->batch->start : -1;
+
+	return typename FitnessCache<F>::Key(individual->get_phenotype_hash(),
+			batch_start);
+}
+
+/// @brief Sets the fitness of an individual from the cache if its phenotype is known
+/// @details The recorded hits are restored along with the fitness. The individual must 
+/// have been decoded last by the evaluator of this problem, whose canonical phenotype 
+/// is compared with the cache entry.
+/// @param individual decoded individual
+/// @return true if the individual has been evaluated by the cache
+template<class E, class G, class F>
+bool BlackBoxProblem<E, G, F>::lookup_fitness(
+		const std::shared_ptr<Individual<G, F>> &individual) {
+
+	if (this->fitness_cache == nullptr) {
+		return false;
+	}
+
+	F fitness;
+	int hits;
+
+	if (!this->fitness_cache->lookup(this->fitness_key(individual),
+			this->evaluator->get_phenotype(), fitness, hits)) {
+		return false;
+	}
+
+	individual->set_fitness(fitness);
+	individual->set_evaluated(true);
+	individual->set_pruned(false);
+	individual->set_screened(false);
+	individual->set_hits(hits);
+
+	return true;
+}
+
+/// @brief Returns the lowest error that the evaluated instances can add up to
+template<class E, class G, class F>
+F BlackBoxProblem<E, G, F>::racing_bound() const {
+	F remaining = 0;
+
+	for (int k = 0; k < this->num_batch_instances(); k++) {
+		remaining += this->instance_lower_bound(this->instance_at(k));
+	}
+
+	return remaining;
+}
+
+/// @brief Checks whether an individual can still reach the cut-off bound
+/// @details The error of the instances that have not been evaluated yet is bounded
+/// by their lower bound. If even this best case exceeds the cut-off bound, the
+/// individual is marked as pruned with the bound as fitness.
+/// @param individual individual under evaluation
+/// @param diff error of the instances evaluated so far
+/// @param remaining lower bound of the remaining instances, updated by the instance
+/// @param instance index of the instance that has just been evaluated
+/// @param bound cut-off bound
+/// @return true if the evaluation has been aborted
+template<class E, class G, class F>
+bool BlackBoxProblem<E, G, F>::race(
+		const std::shared_ptr<Individual<G, F>> &individual, F diff, F &remaining,
+		int instance, F bound) {
+
+	remaining -= this->instance_lower_bound(instance);
+
+	if (diff + remaining <= bound) {
+		return false;
+	}
+
+	if (this->instance_aborts != nullptr) {
+		(*this->instance_aborts)[instance].fetch_add(1,
+				std::memory_order_relaxed);
+	}
+
+	individual->set_fitness(diff + remaining);
+	individual->set_evaluated(true);
+	individual->set_pruned(true);
+	individual->set_screened(false);
+	individual->set_hits(-1);
+
+	return true;
+}
+
+/// @brief Returns the instance that is evaluated at the given position
+/// @details Instances of a mini-batch are evaluated in the order of the batch.
+template<class E, class G, class F>
+int BlackBoxProblem<E, G, F>::instance_at(int position) const {
+	if (this->batch != nullptr) {
+		return this->batch->instances[position];
+	}
+	if (this->instance_order != nullptr) {
+		return (*this->instance_order)[position];
+	}
+	return position;
+}
+
+/// @brief Writes the inputs and constants of a block of instances to the input registers
+/// @details The rows of the instances are transposed so that each input register 
+/// holds the values of all lanes.
+/// @param start position of the first instance of the block
+/// @param lanes number of instances in the block
+/// @param registers block register file of the evaluator
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::load_block(int start, int lanes, E *registers) {
+	for (int lane = 0; lane < lanes; lane++) {
+		this->load_instance(this->instance_at(start + lane), lane, registers);
+	}
+}
+
+/// @brief Writes the inputs and constants of an instance to a lane of the input registers
+/// @param instance index of the instance
+/// @param lane lane of the block register file
+/// @param registers block register file of the evaluator
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::load_instance(int instance, int lane,
+		E *registers) {
+
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	const E *row = this->input_row(instance);
+
+	for (int j = 0; j < this->num_inputs; j++) {
+		registers[j * block_lanes + lane] = row[j];
+	}
+}
+
+/// @brief Computes the error of each instance of an executed block
+/// @details Collects the output registers of each lane and calls evaluate().
+/// @param program executed program
+/// @param registers block register file of the evaluator
+/// @param start position of the first instance of the block
+/// @param lanes number of instances in the block
+/// @param errors receives the error of each lane
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::evaluate_block(const Program &program,
+		const E *registers, int start, int lanes, F errors[]) {
+
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	std::vector<E> &outputs_ind = *this->outputs_individual;
+	int num_outputs = program.outputs.size();
+	outputs_ind.resize(num_outputs);
+
+	for (int lane = 0; lane < lanes; lane++) {
+		for (int k = 0; k < num_outputs; k++) {
+			outputs_ind[k] = registers[program.outputs[k] * block_lanes + lane];
+		}
+
+		errors[lane] = this->evaluate(
+				this->outputs->at(this->instance_at(start + lane)), outputs_ind);
+	}
+}
+
+/// @brief Sorts the instances by the number of aborts they have caused
+/// @details Instances that frequently exceed the cut-off bound are evaluated first,
+/// so that bad offspring are pruned earlier. Must not be called during evaluation.
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::update_instance_order() {
+
+	if (this->instance_order == nullptr) {
+		return;
+	}
+
+	const std::vector<std::atomic<long long>> &aborts = *this->instance_aborts;
+
+	std::stable_sort(this->instance_order->begin(), this->instance_order->end(),
+			[&aborts](int a, int b) {
+				return aborts[a].load(std::memory_order_relaxed)
+						> aborts[b].load(std::memory_order_relaxed);
+			});
+}
+
+/// @brief Stores the fitness and the recorded hits of an evaluated individual in the cache
+/// @details Pruned individuals are not stored since their fitness is only a bound.
+/// The individual must have been decoded last by the evaluator of this problem.
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::store_fitness(
+		const std::shared_ptr<Individual<G, F>> &individual) {
+
+	if (this->fitness_cache != nullptr && !individual->is_pruned()) {
+		this->fitness_cache->insert(this->fitness_key(individual),
+				this->evaluator->get_phenotype(), individual->get_fitness(),
+				individual->get_hits());
+	}
+}
+
 
 /// @brief Evaluates an individual against the given input/output matching
-/// @details Iterative evaluation procedure for each instance of the problem.
+/// @details Iterative evaluation procedure for each instance of the problem or
+/// of the current mini-batch.
+/// The individual is decoded by the evaluator of this problem instance, so decoding
+/// runs in the evaluation thread.
+/// With racing enabled, the evaluation stops as soon as the individual can no
+/// longer reach the cut-off bound (see race()).
 /// @param individual individual to evaluate
+/// @param bound cut-off bound for racing
 template<class E, class G, class F>
 void BlackBoxProblem<E, G, F>::evaluate_individual(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual, F bound) {
 
 	if (individual->is_evaluated()) {
 		return;
 	}
 
+	this->evaluator->decode_path(individual);
+
+	if (this->lookup_fitness(individual)) {
+		return;
+	}
+
 	F diff = 0;
+	this->hits = 0;
 
-	std::shared_ptr<std::vector<E>> input_instance;
-	std::shared_ptr<std::vector<E>> output_instace;
-	std::shared_ptr<std::vector<E>> outputs_ind = std::make_shared<
-			std::vector<E>>();
+	// Decode the genome once and run the compiled program on blocks of instances
+	const Program &program = this->evaluator->compile(individual);
 
-	for (int i = 0; i < this->num_instances; i++) {
-		input_instance = std::make_shared<std::vector<E>>(this->inputs->at(i));
-		output_instace = std::make_shared<std::vector<E>>(this->outputs->at(i));
+	E *registers = this->evaluator->get_block_registers();
+	int block_lanes = this->evaluator->get_block_lanes();
 
-		if (this->num_constants > 0) {
-			input_instance->insert(std::end(*input_instance),
-					std::begin(*constants), std::end(*constants));
+	this->block_errors.resize(block_lanes);
+
+	F remaining = this->racing ? this->racing_bound() : 0;
+
+	int num_evaluated = this->num_batch_instances();
+
+	for (int start = 0; start < num_evaluated; start += block_lanes) {
+		int lanes = std::min(block_lanes, num_evaluated - start);
+
+		this->load_block(start, lanes, registers);
+
+		this->evaluator->execute_block(program, lanes);
+
+		this->evaluate_block(program, registers, start, lanes,
+				this->block_errors.data());
+
+		for (int lane = 0; lane < lanes; lane++) {
+			diff += this->block_errors[lane];
+
+			if (this->racing && this->race(individual, diff, remaining,
+					this->instance_at(start + lane), bound)) {
+				return;
+			}
 		}
+	}
+
+	individual->set_fitness(diff);
+	individual->set_evaluated(true);
+	individual->set_pruned(false);
+	individual->set_screened(false);
+	individual->set_hits(
+			this->counting_hits && this->batch == nullptr ? this->hits : -1);
+
+	this->store_fitness(individual);
+}
+
+/// @brief Evaluates an offspring against the cached node values of its parent
+/// @details Only the nodes in the forward cone of the genes that differ from the 
+/// cached parent are recomputed for each instance. The recomputed values are stored 
+/// in the overlay so that the cache can be moved to the offspring if it is selected.
+/// Offspring whose fitness is taken from the fitness cache or that have been pruned
+/// by racing leave the overlay incomplete.
+/// @param individual offspring to evaluate
+/// @param cache node values of the parent
+/// @param overlay storage for the recomputed node values
+/// @param bound cut-off bound for racing
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::evaluate_incremental(
+		const std::shared_ptr<Individual<G, F>> &individual,
+		const NodeCache<E, G, F> &cache, NodeOverlay<E> &overlay, F bound) {
 
-		outputs_ind->clear();
+	if (individual->is_evaluated()) {
+		return;
+	}
 
-		mtx.lock();
-		this->evaluator->evaluate_iterative(individual, input_instance,
-				outputs_ind);
-		mtx.unlock();
+	this->evaluator->decode_path(individual);
 
-		diff += this->evaluate(output_instace, outputs_ind);
+	if (this->lookup_fitness(individual)) {
+		overlay.complete = false;
+		return;
+	}
+
+	F diff = 0;
+	this->hits = 0;
+
+	const Program &program = this->evaluator->compile_incremental(individual,
+			cache);
+
+	int num_nodes = program.size();
+	int num_loads = program.loads.size();
+
+	int num_evaluated = this->num_batch_instances();
+
+	// Only the rows of the evaluated instances are recorded
+	overlay.nodes = program.nodes;
+	overlay.complete = true;
+	overlay.instances.resize(num_evaluated);
+	overlay.values.resize((size_t) num_evaluated * num_nodes);
+
+	E *registers = this->evaluator->get_block_registers();
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	const E *results = registers + (size_t) program.num_inputs * block_lanes;
+
+	this->block_errors.resize(block_lanes);
+
+	F remaining = this->racing ? this->racing_bound() : 0;
+
+	for (int start = 0; start < num_evaluated; start += block_lanes) {
+		int lanes = std::min(block_lanes, num_evaluated - start);
+
+		// Load the cached node values of the block into the input registers
+		for (int lane = 0; lane < lanes; lane++) {
+			const E *row = cache.row(this->instance_at(start + lane));
+
+			for (int j = 0; j < num_loads; j++) {
+				registers[j * block_lanes + lane] = row[program.loads[j]];
+			}
+		}
+
+		this->evaluator->execute_block(program, lanes);
+
+		this->evaluate_block(program, registers, start, lanes,
+				this->block_errors.data());
+
+		for (int lane = 0; lane < lanes; lane++) {
+			int i = this->instance_at(start + lane);
+
+			overlay.instances[start + lane] = i;
+
+			E *values = overlay.values.data() + (size_t) (start + lane) * num_nodes;
+			for (int k = 0; k < num_nodes; k++) {
+				values[k] = results[(size_t) k * block_lanes + lane];
+			}
+
+			diff += this->block_errors[lane];
+
+			if (this->racing
+					&& this->race(individual, diff, remaining, i, bound)) {
+				overlay.complete = false;
+				return;
+			}
+		}
 	}
 
 	individual->set_fitness(diff);
 	individual->set_evaluated(true);
+	individual->set_pruned(false);
+	individual->set_screened(false);
+	individual->set_hits(
+			this->counting_hits && this->batch == nullptr ? this->hits : -1);
+
+	this->store_fitness(individual);
+}
+
+/// @brief Fills the cache with the node values of an individual for each evaluated instance
+/// @details Runs the compiled program on blocks of instances like evaluate_individual().
+/// @param individual decoded individual to cache
+/// @param cache cache to fill
+template<class E, class G, class F>
+void BlackBoxProblem<E, G, F>::cache_individual(
+		const std::shared_ptr<Individual<G, F>> &individual,
+		NodeCache<E, G, F> &cache) {
+
+	const Program &program = this->evaluator->compile(individual);
+
+	int num_nodes = program.size();
+	int num_evaluated = this->num_batch_instances();
+
+	E *registers = this->evaluator->get_block_registers();
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	for (int start = 0; start < num_evaluated; start += block_lanes) {
+		int lanes = std::min(block_lanes, num_evaluated - start);
+
+		this->load_block(start, lanes, registers);
+
+		this->evaluator->execute_block(program, lanes);
+
+		for (int lane = 0; lane < lanes; lane++) {
+			E *row = cache.row(this->instance_at(start + lane));
+
+			for (int j = 0; j < program.num_inputs; j++) {
+				row[j] = registers[j * block_lanes + lane];
+			}
+
+			for (int k = 0; k < num_nodes; k++) {
+				row[program.nodes[k]] = registers[(size_t) (program.num_inputs
+						+ k) * block_lanes + lane];
+			}
+		}
+	}
+
+	cache.assign(individual);
 }
 
 #endif /* PROBLEMS_BLACKBOXPROBLEM_H_ */
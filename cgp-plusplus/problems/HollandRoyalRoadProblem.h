@@ -26,7 +26,7 @@ private:
     const int string_length = 240; // 2^k * (b+g)
 
     // Helper function for calculating PART
-    double calculate_part_fitness(const std::shared_ptr<std::vector<E>>& bit_string) {
+    double calculate_part_fitness(const std::vector<E>& bit_string) {
         double total_part_fitness = 0.0;
         
         for (int i = 0; i < num_regions; i++) {
@@ -35,7 +35,7 @@ private:
 
             // Calculate "ones" only in the block (length b), ignoring the gap
             for (int j = 0; j < b; j++) {
-                if (bit_string->at(block_start + j) != 0) {
+                if (bit_string[block_start + j] != 0) {
                     ones_in_block++;
                 }
             }
@@ -58,7 +58,7 @@ private:
     }
 
     // Helper function for calculating BONUS
-    double calculate_bonus_fitness(const std::shared_ptr<std::vector<E>>& bit_string) {
+    double calculate_bonus_fitness(const std::vector<E>& bit_string) {
         double total_bonus_fitness = 0.0;
         
         std::vector<bool> complete_blocks(num_regions, false);
@@ -68,7 +68,7 @@ private:
             int block_start = i * region_length;
             bool is_complete = true;
             for (int j = 0; j < b; j++) {
-                if (bit_string->at(block_start + j) == 0) {
+                if (bit_string[block_start + j] == 0) {
                     is_complete = false;
                     break;
                 }
@@ -117,7 +117,7 @@ public:
                             std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
                             std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
                             std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-                            std::shared_ptr<std::vector<E>> p_constants,
+                            const std::shared_ptr<std::vector<E>> &p_constants,
                             int p_num_instances)
         : BlackBoxProblem<E, G, F>(p_parameters, p_evaluator, p_inputs, p_outputs, p_constants, p_num_instances) {
         this->name = "Holland's Royal Road Problem";
@@ -128,13 +128,13 @@ public:
     // Destructor
     ~HollandRoyalRoadProblem() = default;
 
-    F evaluate(std::shared_ptr<std::vector<E>> outputs_real,
-               std::shared_ptr<std::vector<E>> outputs_individual) override {
+    F evaluate(const std::vector<E> &outputs_real,
+               const std::vector<E> &outputs_individual) override {
         
         // 'outputs_real' is ignored. There is no "objective"
         // 'outputs_individual' is our phenotype, the 240-bit string.
         
-        if (outputs_individual->size() != string_length) {
+        if (outputs_individual.size() != string_length) {
             // Throw an exception if the CGP is not producing 240 outputs
             throw std::length_error("HRRProblem expects a 240-bit string from the individual.");
         }
@@ -38,7 +38,7 @@ public:
 			std::shared_ptr<Evaluator<E,G,F>> p_evalutor,
 			std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 			std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-			std::shared_ptr<std::vector<E>> p_constants,
+			const std::shared_ptr<std::vector<E>> &p_constants,
 			int p_num_instances);
 
 	~LogicSynthesisProblem() = default;
@@ -46,8 +46,8 @@ public:
 	int get_bit(E n, E k);
 	F evaluate(E output_real, E output_individual);
 
-	F evaluate(std::shared_ptr<std::vector<E>> outputs_real,
-			std::shared_ptr<std::vector<E>> outputs_individual) override;
+	F evaluate(const std::vector<E> &outputs_real,
+			const std::vector<E> &outputs_individual) override;
 	LogicSynthesisProblem<E, G, F>* clone() override;
 
 };
@@ -57,7 +57,7 @@ LogicSynthesisProblem<E, G, F>::LogicSynthesisProblem(std::shared_ptr<Parameters
 		std::shared_ptr<Evaluator<E,G,F>> p_evaluator,
 		std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 		std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-		std::shared_ptr<std::vector<E>> p_constants,
+		const std::shared_ptr<std::vector<E>> &p_constants,
 		int p_num_instances) :
 		BlackBoxProblem<E, G, F>(p_parameters, p_evaluator,  p_inputs,  p_outputs , p_constants, p_num_instances) {
 
@@ -86,13 +86,13 @@ int LogicSynthesisProblem<E, G, F>::get_bit(E n, E k) {
 /// @return 
 template<class E, class G, class F>
 F LogicSynthesisProblem<E, G, F>::evaluate(
-		std::shared_ptr<std::vector<E>> outputs_real,
-		std::shared_ptr<std::vector<E>> outputs_individual) {
+		const std::vector<E> &outputs_real,
+		const std::vector<E> &outputs_individual) {
 	int diff = 0;
 
 	
 	for (int i = 0; i < this->num_outputs; i++) {
-		diff += this->evaluate(outputs_real->at(i), outputs_individual->at(i));
+		diff += this->evaluate(outputs_real[i], outputs_individual[i]);
 	}
 	return diff;
 }
@@ -0,0 +1,58 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: MiniBatch.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef PROBLEMS_MINIBATCH_H_
+#define PROBLEMS_MINIBATCH_H_
+
+#include <stdexcept>
+#include <vector>
+
+/// @brief Rotating window of instances that is evaluated instead of the whole dataset.
+/// @details The window holds batch size consecutive instances, wrapping around at the
+/// end of the dataset. Each advance moves the window by its size, so every instance
+/// is evaluated once per pass over the dataset.
+struct MiniBatch {
+	// Instances of the current batch in evaluation order
+	std::vector<int> instances;
+	// First instance of the current batch
+	int start = 0;
+
+	/// @brief Creates the first batch, starting at instance 0.
+	/// @param size number of instances per batch
+	/// @param num_instances number of instances of the dataset
+	MiniBatch(int size, int num_instances) :
+			instances(size) {
+
+		if (size <= 0 || size > num_instances) {
+			throw std::invalid_argument(
+					"Batch size must be between 1 and the number of instances!");
+		}
+
+		this->fill(num_instances);
+	}
+
+	/// @brief Moves the window to the following instances.
+	/// @param num_instances number of instances of the dataset
+	void advance(int num_instances) {
+		this->start = (this->start + (int) this->instances.size()) % num_instances;
+		this->fill(num_instances);
+	}
+
+private:
+	void fill(int num_instances) {
+		for (int k = 0; k < (int) this->instances.size(); k++) {
+			this->instances[k] = (this->start + k) % num_instances;
+		}
+	}
+};
+
+#endif /* PROBLEMS_MINIBATCH_H_ */
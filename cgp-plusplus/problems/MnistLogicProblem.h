@@ -6,140 +6,256 @@
 #include <memory>
 #include <algorithm>
 #include <iostream>
+#include <limits>
 
 template<class E, class G, class F>
 class MnistLogicProblem : public BlackBoxProblem<E, G, F> {
 private:
+    static constexpr int NUM_CLASSES = 10;
+    static constexpr int MAX_LANES = std::numeric_limits<E>::digits;
+    static constexpr int MAX_PLANES = std::numeric_limits<int>::digits;
+
     int bits_per_class;
-    const int NUM_CLASSES = 10;
+    int num_planes;
+    int num_samples;
+    bool bit_sliced;
 
-public:
-    MnistLogicProblem(std::shared_ptr<Parameters> p_parameters,
-                      std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
-                      std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
-                      std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-                      std::shared_ptr<std::vector<E>> p_constants,
-                      int p_num_instances)
-        : BlackBoxProblem<E, G, F>(p_parameters, p_evaluator, p_inputs, p_outputs, p_constants, p_num_instances) {
-        
-        this->name = "MNIST Logic Problem";
-        
-        // Calcoliamo i bit per classe dinamicamente dal numero totale di output
-        // Es: 500 output / 10 classi = 50 bit per classe
-        if (this->parameters->get_num_outputs() % NUM_CLASSES != 0) {
-            throw std::invalid_argument("Total outputs must be a multiple of 10 (classes)!");
+    /**
+     * @brief Counts the set bits of a class block separately for every lane (image) of the word.
+     * @details Vertical popcount: the output words of the block are accumulated in a
+     * bit-sliced carry-save counter whose k-th plane holds bit k of the per-lane count.
+     * One pass over the block therefore counts the class bits of all packed images.
+     * Without bit slicing, every non-zero output word counts as one set bit.
+     * @param outputs_individual Output words produced by the network for one instance.
+     * @param class_idx Index of the class block.
+     * @param num_lanes Number of used lanes in the instance.
+     * @param counts Per-lane number of set bits (output).
+     */
+    void count_class_bits(const std::vector<E> &outputs_individual, int class_idx,
+                          int num_lanes, int counts[]) {
+        E planes[MAX_PLANES] = {};
+        int start_idx = class_idx * this->bits_per_class;
+
+        // One image per instance: any non-zero output word counts as a set bit
+        if (!this->bit_sliced) {
+            int count = 0;
+            for (int bit = 0; bit < this->bits_per_class; ++bit) {
+                if (outputs_individual[start_idx + bit] != 0) {
+                    count++;
+                }
+            }
+            counts[0] = count;
+            return;
+        }
+
+        for (int bit = 0; bit < this->bits_per_class; ++bit) {
+            E carry = outputs_individual[start_idx + bit];
+            for (int k = 0; k < this->num_planes && carry != 0; ++k) {
+                E overflow = planes[k] & carry;
+                planes[k] ^= carry;
+                carry = overflow;
+            }
+        }
+
+        for (int lane = 0; lane < num_lanes; ++lane) {
+            int count = 0;
+            for (int k = 0; k < this->num_planes; ++k) {
+                count |= static_cast<int>((planes[k] >> lane) & 1) << k;
+            }
+            counts[lane] = count;
         }
-        this->bits_per_class = this->parameters->get_num_outputs() / NUM_CLASSES;
     }
 
-    ~MnistLogicProblem() = default;
-    
     /**
-     * @brief Calculates the exact number of correctly classified images.
-     * This method is separate from the fitness and is only used for reporting.
+     * @brief Scores all images packed into one instance.
+     * @details The class whose block has the most bits set wins (ties go to the lower class index).
+     * A correct prediction scores minus its strength, a wrong one scores
+     * 50 plus the margin to the winning class (minimization).
+     * @param labels True labels of the packed images, one per used lane.
+     * @param outputs_individual Output words produced by the network.
+     * @param hits Incremented by the number of correctly classified images.
+     * @param confusion Optional confusion matrix, confusion[label * 10 + prediction] is incremented.
+     * @return Summed score of the packed images.
      */
-    int validate_individual(std::shared_ptr<Individual<G, F>> individual) override {
-        int hits = 0;
-        
-        // Temporary vectors for the individual's output
-        std::shared_ptr<std::vector<E>> outputs_ind = std::make_shared<std::vector<E>>();
-        
-        // Loop over all images (instances)
-        for (int i = 0; i < this->num_instances; i++) {
-            
-            // 1. Run the network on the current image
-            // Note: we need to reconstruct the full input for the evaluator
-            std::shared_ptr<std::vector<E>> input_instance = std::make_shared<std::vector<E>>(this->inputs->at(i));
-            
-            // If there are constants (in your config they are 0, but we keep for compatibility)
-            if (this->constants != nullptr && !this->constants->empty()) {
-                input_instance->insert(std::end(*input_instance), std::begin(*this->constants), std::end(*this->constants));
-            }
+    F score_instance(const std::vector<E> &labels, const std::vector<E> &outputs_individual,
+                     int &hits, long long *confusion = nullptr) {
+        int num_lanes = labels.size();
+        int counts[NUM_CLASSES][MAX_LANES];
 
-            outputs_ind->clear();
-            
-            // Valuta l'individuo (senza lock mtx qui, siamo nel thread principale di report)
-            this->evaluator->evaluate_iterative(individual, input_instance, outputs_ind);
+        for (int class_idx = 0; class_idx < NUM_CLASSES; ++class_idx) {
+            this->count_class_bits(outputs_individual, class_idx, num_lanes, counts[class_idx]);
+        }
 
-            // 2. Logica di Classificazione (Bit Counting)
-            int true_label = static_cast<int>(this->outputs->at(i)[0]);
+        F score = 0;
+
+        for (int lane = 0; lane < num_lanes; ++lane) {
+            int true_label = static_cast<int>(labels[lane]);
             int best_class = -1;
             int max_bits_on = -1;
 
+            // ArgMax: in caso di pareggio vince la classe con indice minore.
             for (int class_idx = 0; class_idx < NUM_CLASSES; ++class_idx) {
-                int current_bits_on = 0;
-                int start_idx = class_idx * this->bits_per_class;
-
-                for (int bit = 0; bit < this->bits_per_class; ++bit) {
-                    if (outputs_ind->at(start_idx + bit) != 0) {
-                        current_bits_on++;
-                    }
-                }
-
-                if (current_bits_on > max_bits_on) {
-                    max_bits_on = current_bits_on;
+                if (counts[class_idx][lane] > max_bits_on) {
+                    max_bits_on = counts[class_idx][lane];
                     best_class = class_idx;
                 }
             }
 
-            // 3. Incrementa Hits se corretto
+            int prediction_strength = counts[true_label][lane];
+
+            if (confusion != nullptr) {
+                confusion[true_label * NUM_CLASSES + best_class]++;
+            }
+
+            // the more bits on for the correct class, the better
             if (best_class == true_label) {
                 hits++;
+                score += 0 - prediction_strength;
+            } else {
+                score += 50.0 + (max_bits_on - prediction_strength); // the more its wrong, the worse
             }
         }
-        return hits;
+
+        return score;
     }
 
     /**
-     * @brief Valuta una singola predizione.
-     * @param outputs_real Contiene la LABEL vera come unico elemento (vedi Initializer).
-     * @param outputs_individual Contiene la stringa di bit prodotta dalla rete (es. 500 bit).
-     * @return 0.0 se la predizione è corretta, 1.0 se è errata (Minimizzazione).
+     * @brief Runs the network on all instances and counts the correctly classified images.
+     * @details Uses the block evaluation of the evaluator like the fitness evaluation.
+     * All instances are classified, also when the fitness is evaluated on mini-batches.
+     * Individuals that have not been evaluated (e.g. mutants) are decoded first, since
+     * their active nodes may be inherited from the parent.
+     * @param individual Individual to classify.
+     * @param confusion Optional confusion matrix (see score_instance()).
+     * @return Number of correctly classified images.
      */
-    F evaluate(std::shared_ptr<std::vector<E>> outputs_real,
-               std::shared_ptr<std::vector<E>> outputs_individual) override {
-        
-        // 1. Recupera la vera etichetta (Salvata nell'elemento 0 dal nostro Initializer)
-        int true_label = static_cast<int>(outputs_real->at(0));
+    int classify(const std::shared_ptr<Individual<G, F>> &individual, long long *confusion) {
+        int hits = 0;
 
-        // 2. Logica di Bit-Counting (Population Count)
-        int best_class = -1;
-        int max_bits_on = -1;
-        int prediction_strength = 0;
+        if (!individual->is_evaluated()) {
+            this->evaluator->decode_path(individual);
+        }
 
+        const Program &program = this->evaluator->compile(individual);
 
-        // Itera su ogni classe (0-9)
-        for (int class_idx = 0; class_idx < NUM_CLASSES; ++class_idx) {
-            int current_bits_on = 0;
-            int start_idx = class_idx * this->bits_per_class;
+        E *registers = this->evaluator->get_block_registers();
+        int block_lanes = this->evaluator->get_block_lanes();
 
-            // Conta i bit a '1' nel blocco dedicato a questa classe
-            for (int bit = 0; bit < this->bits_per_class; ++bit) {
-                // Consideriamo qualsiasi valore != 0 come '1' logico (per sicurezza)
-                if (outputs_individual->at(start_idx + bit) != 0) {
-                    current_bits_on++;
-                }
-            }
+        std::vector<E> &outputs_ind = *this->outputs_individual;
+        int num_outputs = program.outputs.size();
+        outputs_ind.resize(num_outputs);
 
-            // ArgMax: Se questo blocco ha più '1' del precedente record, diventa il vincitore.
-            // Nota: In caso di pareggio, qui vince la classe con indice minore.
-            if (current_bits_on > max_bits_on) {
-                max_bits_on = current_bits_on;
-                best_class = class_idx;
+        for (int start = 0; start < this->num_instances; start += block_lanes) {
+            int lanes = std::min(block_lanes, this->num_instances - start);
+
+            for (int lane = 0; lane < lanes; lane++) {
+                this->load_instance(start + lane, lane, registers);
             }
-            if (class_idx == true_label) {
-                prediction_strength = current_bits_on;
+            this->evaluator->execute_block(program, lanes);
+
+            for (int lane = 0; lane < lanes; lane++) {
+                for (int k = 0; k < num_outputs; k++) {
+                    outputs_ind[k] = registers[program.outputs[k] * block_lanes + lane];
+                }
+
+                this->score_instance(this->outputs->at(start + lane),
+                                     outputs_ind, hits, confusion);
             }
         }
 
-        // the more bits on for the correct class, the better
-        if (best_class == true_label) {
-            return 0 - prediction_strength;
-        } else {
-            return 50.0 + (max_bits_on - prediction_strength); // the more its wrong, the worse
+        return hits;
+    }
+
+public:
+    MnistLogicProblem(std::shared_ptr<Parameters> p_parameters,
+                      std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
+                      std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
+                      std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
+                      const std::shared_ptr<std::vector<E>> &p_constants,
+                      int p_num_instances)
+        : BlackBoxProblem<E, G, F>(p_parameters, p_evaluator, p_inputs, p_outputs, p_constants, p_num_instances) {
+        
+        this->name = "MNIST Logic Problem";
+        
+        // Calcoliamo i bit per classe dinamicamente dal numero totale di output
+        // Es: 500 output / 10 classi = 50 bit per classe
+        if (this->parameters->get_num_outputs() % NUM_CLASSES != 0) {
+            throw std::invalid_argument("Total outputs must be a multiple of 10 (classes)!");
+        }
+        this->bits_per_class = this->parameters->get_num_outputs() / NUM_CLASSES;
+
+        // The hits are recorded while the fitness is evaluated (see evaluate())
+        this->counting_hits = true;
+
+        this->bit_sliced = this->parameters->is_bit_sliced();
+
+        // Number of counter planes needed to hold a per-lane count of up to bits_per_class
+        this->num_planes = 1;
+        while ((1 << this->num_planes) <= this->bits_per_class) {
+            this->num_planes++;
+        }
+
+        // Each output row holds the labels of the images packed into the instance
+        this->num_samples = 0;
+        for (int i = 0; i < this->num_instances; i++) {
+            this->num_samples += this->outputs->at(i).size();
         }
     }
 
+    ~MnistLogicProblem() = default;
+
+    int get_num_samples() const override {
+        return this->num_samples;
+    }
+
+    int get_num_classes() const override {
+        return NUM_CLASSES;
+    }
+
+    /**
+     * @brief Lowest score of an instance: every packed image is classified correctly
+     * with all bits of its class set.
+     * @param instance Index of the instance.
+     */
+    F instance_lower_bound(int instance) const override {
+        return -static_cast<F>(this->bits_per_class) * this->outputs->at(instance).size();
+    }
+    
+    /**
+     * @brief Calculates the exact number of correctly classified images.
+     * @details Served from the hits recorded during the fitness evaluation. The network
+     * is only re-run if no record exists, e.g. for evaluations on mini-batches or
+     * evaluations aborted by racing. The fitness cache restores the recorded hits.
+     */
+    int validate_individual(const std::shared_ptr<Individual<G, F>> &individual) override {
+        if (individual->is_evaluated() && individual->get_hits() >= 0) {
+            return individual->get_hits();
+        }
+
+        return this->classify(individual, nullptr);
+    }
+
+    /**
+     * @brief Counts the correctly classified images and fills the confusion matrix.
+     * @details Used by the TestValidator for held-out test data.
+     */
+    int classify_individual(const std::shared_ptr<Individual<G, F>> &individual,
+                            std::vector<long long> &confusion) override {
+        confusion.assign(NUM_CLASSES * NUM_CLASSES, 0);
+        return this->classify(individual, confusion.data());
+    }
+
+    /**
+     * @brief Valuta le predizioni di tutte le immagini contenute in una istanza.
+     * @param outputs_real Contiene le LABEL vere, una per lane (vedi Initializer).
+     * @param outputs_individual Contiene le parole di bit prodotte dalla rete (es. 500 parole).
+     * @return Somma dei punteggi delle immagini (Minimizzazione).
+     */
+    F evaluate(const std::vector<E> &outputs_real,
+               const std::vector<E> &outputs_individual) override {
+        return this->score_instance(outputs_real, outputs_individual, this->hits);
+    }
+
     MnistLogicProblem<E, G, F>* clone() override {
         return new MnistLogicProblem<E, G, F>(*this);
     }
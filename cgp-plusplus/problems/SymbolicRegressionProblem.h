@@ -16,28 +16,46 @@
 #include "../problems/BlackBoxProblem.h"
 
 #include <cmath>
+#include <vector>
+#include <algorithm>
 
 /// @brief Class to represent of a sybolic regression problem.
-/// @details Absolute difference is used fitness calculation.
+/// @details Absolute difference is used fitness calculation. The dataset is stored 
+/// column-major, so that the evaluator runs each active node on whole columns of 
+/// up to COLUMN_LANES rows.
 /// @tparam E Evalation type 
 /// @tparam G Genome type 
 /// @tparam F Fitness type
 template<class E, class G, class F>
 class SymbolicRegressionProblem: public BlackBoxProblem<E, G, F> {
 private:
+	// Input variables and real outputs of the dataset, column j starts at j * num_instances
+	std::shared_ptr<const std::vector<E>> input_columns;
+	std::shared_ptr<const std::vector<E>> output_columns;
+
+	static void accumulate_error(const E *outputs_individual,
+			const E *outputs_real, F errors[], int lanes);
+
+protected:
+	void load_block(int start, int lanes, E *registers) override;
+	void evaluate_block(const Program &program, const E *registers, int start,
+			int lanes, F errors[]) override;
 
 public:
+	static constexpr int COLUMN_LANES = 1024;
+
 	SymbolicRegressionProblem(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
 			std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 			std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-			std::shared_ptr<std::vector<E>> p_constants, int p_num_instances);
+			const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances);
 
 	~SymbolicRegressionProblem() = default;
 
 	SymbolicRegressionProblem<E, G, F>* clone() override;
-	F evaluate(std::shared_ptr<std::vector<E>> outputs_real,
-			std::shared_ptr<std::vector<E>> outputs_individual) override;
+	void init_batches(int size) override;
+	F evaluate(const std::vector<E> &outputs_real,
+			const std::vector<E> &outputs_individual) override;
 };
 
 template<class E, class G, class F>
@@ -46,12 +64,104 @@ SymbolicRegressionProblem<E, G, F>::SymbolicRegressionProblem(
 		std::shared_ptr<Evaluator<E, G, F>> p_evaluator,
 		std::shared_ptr<std::vector<std::vector<E>>> p_inputs,
 		std::shared_ptr<std::vector<std::vector<E>>> p_outputs,
-		std::shared_ptr<std::vector<E>> p_constants, int p_num_instances) :
+		const std::shared_ptr<std::vector<E>> &p_constants, int p_num_instances) :
 		BlackBoxProblem<E, G, F>(p_parameters, p_evaluator, p_inputs, p_outputs,
 				p_constants, p_num_instances) {
 
 	this->name = "Symbolic Regression Problem";
 
+	int n = this->num_instances;
+
+	auto inputs_data = std::make_shared<std::vector<E>>(
+			(size_t) this->num_variables * n);
+	auto outputs_data = std::make_shared<std::vector<E>>(
+			(size_t) this->num_outputs * n);
+
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < this->num_variables; j++) {
+			(*inputs_data)[(size_t) j * n + i] = this->input_row(i)[j];
+		}
+
+		for (int j = 0; j < this->num_outputs; j++) {
+			(*outputs_data)[(size_t) j * n + i] = this->outputs->at(i)[j];
+		}
+	}
+
+	this->input_columns = inputs_data;
+	this->output_columns = outputs_data;
+
+	// The rows are always evaluated in the order of the columns
+	this->instance_order = nullptr;
+	this->instance_aborts = nullptr;
+
+	this->evaluator->set_block_lanes(std::min(n, COLUMN_LANES));
+}
+
+/// @brief Mini-batches are not supported since blocks are contiguous ranges of the columns.
+/// @param size number of instances per batch, 0 evaluates all instances
+template<class E, class G, class F>
+void SymbolicRegressionProblem<E, G, F>::init_batches(int size) {
+	if (size > 0 && size < this->num_instances) {
+		throw std::invalid_argument(
+				"Mini-batches are not supported by symbolic regression problems!");
+	}
+}
+
+/// @brief Copies the input columns of a block and fills the constant columns.
+/// @param start first row of the block
+/// @param lanes number of rows in the block
+/// @param registers block register file of the evaluator
+template<class E, class G, class F>
+void SymbolicRegressionProblem<E, G, F>::load_block(int start, int lanes,
+		E *registers) {
+
+	int block_lanes = this->evaluator->get_block_lanes();
+	const E *columns = this->input_columns->data() + start;
+
+	for (int j = 0; j < this->num_variables; j++) {
+		std::copy(columns, columns + lanes, registers + j * block_lanes);
+		columns += this->num_instances;
+	}
+
+	for (int j = 0; j < this->num_constants; j++) {
+		E *column = registers + (this->num_variables + j) * block_lanes;
+		std::fill(column, column + lanes, (*this->constants)[j]);
+	}
+}
+
+/// @brief Computes the absolute error of each row of an executed block.
+/// @details The errors are accumulated column by column over the outputs, which
+/// gives the same result as evaluate() for each row.
+/// @param program executed program
+/// @param registers block register file of the evaluator
+/// @param start first row of the block
+/// @param lanes number of rows in the block
+/// @param errors receives the error of each row
+template<class E, class G, class F>
+void SymbolicRegressionProblem<E, G, F>::evaluate_block(const Program &program,
+		const E *registers, int start, int lanes, F errors[]) {
+
+	int block_lanes = this->evaluator->get_block_lanes();
+
+	std::fill(errors, errors + lanes, F(0));
+
+	for (int j = 0; j < this->num_outputs; j++) {
+		accumulate_error(registers + program.outputs[j] * block_lanes,
+				this->output_columns->data() + (size_t) j * this->num_instances
+						+ start, errors, lanes);
+	}
+}
+
+/// @brief Adds the absolute difference of an output column to the row errors.
+/// @details Vectorized for the instruction set selected at startup (see CGP_TARGET_CLONES).
+template<class E, class G, class F>
+CGP_TARGET_CLONES
+void SymbolicRegressionProblem<E, G, F>::accumulate_error(
+		const E *outputs_individual, const E *outputs_real, F errors[],
+		int lanes) {
+	for (int i = 0; i < lanes; i++) {
+		errors[i] += std::abs(outputs_individual[i] - outputs_real[i]);
+	}
 }
 
 /// @brief Evaluates the outputs on an individual against the real outputs of the problem.
@@ -62,12 +172,12 @@ SymbolicRegressionProblem<E, G, F>::SymbolicRegressionProblem(
 /// @return 
 template<class E, class G, class F>
 F SymbolicRegressionProblem<E, G, F>::evaluate(
-		std::shared_ptr<std::vector<E>> outputs_real,
-		std::shared_ptr<std::vector<E>> outputs_individual) {
-	float diff = 0;
+		const std::vector<E> &outputs_real,
+		const std::vector<E> &outputs_individual) {
+	F diff = 0;
 
 	for (int i = 0; i < this->num_outputs; i++) {
-		diff += abs(outputs_individual->at(i) - outputs_real->at(i));
+		diff += abs(outputs_individual[i] - outputs_real[i]);
 	}
 
 	return diff;
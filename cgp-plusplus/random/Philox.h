@@ -0,0 +1,111 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: Philox.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef RANDOM_PHILOX_H_
+#define RANDOM_PHILOX_H_
+
+#include <cstdint>
+#include <limits>
+
+/// @brief Counter-based Philox4x32-10 generator by Salmon et al.
+/// @details The output is a bijection of a 128 bit counter under a 64 bit key, so
+/// independent streams are selected by the key and the upper counter words without
+/// any state. The lowest counter word enumerates the blocks of a stream, each block
+/// yields two 64 bit numbers.
+/// @see Salmon et al. (2011): Parallel Random Numbers: As Easy as 1, 2, 3
+/// https://doi.org/10.1145/2063384.2063405
+class Philox4x32 {
+private:
+	std::uint32_t key[2];
+	std::uint32_t counter[4];
+	std::uint32_t block[4];
+	int used;
+
+	static void mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t &hi,
+			std::uint32_t &lo) {
+		std::uint64_t product = (std::uint64_t) a * b;
+		hi = product >> 32;
+		lo = product;
+	}
+
+	void generate() {
+		std::uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2],
+				c3 = counter[3];
+		std::uint32_t k0 = key[0], k1 = key[1];
+		std::uint32_t hi0, lo0, hi1, lo1;
+
+		for (int round = 0; round < 10; round++) {
+			mulhilo(0xD2511F53, c0, hi0, lo0);
+			mulhilo(0xCD9E8D57, c2, hi1, lo1);
+
+			c0 = hi1 ^ c1 ^ k0;
+			c1 = lo1;
+			c2 = hi0 ^ c3 ^ k1;
+			c3 = lo0;
+
+			k0 += 0x9E3779B9;
+			k1 += 0xBB67AE85;
+		}
+
+		block[0] = c0;
+		block[1] = c1;
+		block[2] = c2;
+		block[3] = c3;
+
+		counter[0]++;
+		used = 0;
+	}
+
+public:
+	typedef std::uint64_t result_type;
+
+	Philox4x32() {
+		set_stream(0, 0, 0);
+	}
+
+	/// @brief Selects a stream and restarts it at its first block.
+	/// @param p_key key of the stream family
+	/// @param p_stream upper 64 bit of the stream
+	/// @param p_substream middle 32 bit of the stream
+	void set_stream(std::uint64_t p_key, std::uint64_t p_stream,
+			std::uint32_t p_substream) {
+		key[0] = p_key;
+		key[1] = p_key >> 32;
+		counter[0] = 0;
+		counter[1] = p_substream;
+		counter[2] = p_stream;
+		counter[3] = p_stream >> 32;
+		used = 4;
+	}
+
+	result_type operator()() {
+		if (used == 4) {
+			generate();
+		}
+
+		std::uint64_t result = ((std::uint64_t) block[used] << 32)
+				| block[used + 1];
+		used += 2;
+
+		return result;
+	}
+
+	static constexpr result_type min() {
+		return 0;
+	}
+
+	static constexpr result_type max() {
+		return std::numeric_limits<result_type>::max();
+	}
+};
+
+#endif /* RANDOM_PHILOX_H_ */
@@ -12,6 +12,8 @@
 
 #include "Random.h"
 
+#include <cmath>
+
 /// @brief Constructor to set the global seed. 
 /// @param p_global_seed global seed
 /// @param p_parameters shared pointer to the parameter object 
@@ -27,6 +29,8 @@ Random::Random(long long p_global_seed, std::shared_ptr<Parameters> p_parameters
 		throw std::invalid_argument("Nullpointer exception in fitnessclass!");
 	}
 
+	this->init_generator();
+
 	this->set_seed(p_global_seed);
 }
 
@@ -38,15 +42,78 @@ Random::Random(std::shared_ptr<Parameters> p_parameters) {
 		throw std::invalid_argument("Nullpointer exception in fitnessclass!");
 	}
 
+	this->init_generator();
+
 	this->set_random_seed();
 }
 
+/// @brief Selects the generator according to the rng_type parameter.
+void Random::init_generator() {
+	RNG_TYPE rng_type = this->parameters->get_rng_type();
+
+	if (rng_type != this->parameters->MERSENNE_TWISTER
+			&& rng_type != this->parameters->XOSHIRO256) {
+		throw std::invalid_argument("Unknown random generator type!");
+	}
+
+	this->use_xoshiro = (rng_type == this->parameters->XOSHIRO256);
+	this->streaming = false;
+	this->use_mt = !this->use_xoshiro;
+	this->stream_epoch = 0;
+}
+
+/// @brief Returns the next 64 bit number of the stream or of the xoshiro256**.
+std::uint64_t Random::next() {
+	if (this->streaming) {
+		return this->philox();
+	}
+	return this->xoshiro();
+}
+
+/// @brief Returns an unbiased random integer in [0, range) by Lemire's method.
+/// @details Multiplies a 32 bit random number with the range instead of dividing,
+/// the rejection is only reached with a probability of range / 2^32.
+/// @see Lemire (2019): Fast Random Integer Generation in an Interval
+/// https://doi.org/10.1145/3230636
+/// @param range size of the interval, at most 2^32
+/// @return random integer
+std::uint32_t Random::bounded(std::uint64_t range) {
+	std::uint64_t x = this->next() >> 32;
+
+	if (range > 0xffffffffULL) {
+		return x;
+	}
+
+	std::uint64_t m = x * range;
+	std::uint32_t low = m;
+
+	if (low < range) {
+		std::uint32_t threshold = -(std::uint32_t) range % (std::uint32_t) range;
+		while (low < threshold) {
+			x = this->next() >> 32;
+			m = x * range;
+			low = m;
+		}
+	}
+
+	return m >> 32;
+}
+
+/// @brief Returns a random double in [0, 1) from the upper 53 bits.
+double Random::uniform() {
+	return (this->next() >> 11) * 0x1.0p-53;
+}
+
 /// @brief Return a random integer drawn from uniform distribution
 /// in the clossed interval [a,b]
 /// @param a lower bound of the interval
 /// @param b higher bound of the interval
 /// @return random integer 
 int Random::random_integer(int a, int b) {
+	if (!this->use_mt) {
+		return a + (int) this->bounded((std::int64_t) b - a + 1);
+	}
+
 	std::uniform_int_distribution<> distrib(a, b);
 	return distrib(rng);
 }
@@ -58,6 +125,10 @@ int Random::random_integer(int a, int b) {
 /// @param b higher bound of the interval
 /// @return random integer number
 float Random::random_float(float a, float b) {
+	if (!this->use_mt) {
+		return a + (b - a) * this->uniform();
+	}
+
 	std::uniform_real_distribution<> distrib(a, b);
 	return distrib(rng);
 }
@@ -66,22 +137,172 @@ float Random::random_float(float a, float b) {
 /// @param a probability used to draw the Boolean value by chance
 /// @return randon Boolean value
 bool Random::random_bool(float p) {
+	if (!this->use_mt) {
+		return this->uniform() < p;
+	}
+
 	std::uniform_real_distribution<> distrib(0.0, 1.0);
 	return (distrib(rng) < p);
 }
 
+/// @brief Draws the positions and values of n genes for one offspring.
+/// @details The positions are drawn with replacement from [0, size), the value of
+/// each gene from [lower[position], upper[position]]. Positions and values are
+/// drawn alternately, so the mt19937 reproduces the draws of single calls.
+/// @param n number of genes
+/// @param size number of positions
+/// @param lower minimum value per position
+/// @param upper maximum value per position
+/// @param positions array of at least n positions to fill
+/// @param values array of at least n values to fill
+void Random::random_genes(int n, int size, const int *lower, const int *upper,
+		int *positions, int *values) {
+
+	int position;
+
+	if (!this->use_mt) {
+		for (int i = 0; i < n; i++) {
+			position = this->bounded(size);
+			positions[i] = position;
+			values[i] = lower[position]
+					+ (int) this->bounded(
+							(std::int64_t) upper[position] - lower[position] + 1);
+		}
+	} else {
+		for (int i = 0; i < n; i++) {
+			position = this->random_integer(0, size - 1);
+			positions[i] = position;
+			values[i] = this->random_integer(lower[position], upper[position]);
+		}
+	}
+}
+
+/// @brief Draws the values of the genes at the given positions.
+/// @param lower minimum value per position
+/// @param upper maximum value per position
+/// @param positions positions of the genes
+/// @param n number of genes
+/// @param values array of at least n values to fill
+void Random::random_integers(const int *lower, const int *upper,
+		const int *positions, int n, int *values) {
+
+	int position;
+
+	for (int i = 0; i < n; i++) {
+		position = positions[i];
+		values[i] = this->random_integer(lower[position], upper[position]);
+	}
+}
+
+/// @brief Selects every position in [0, size) independently with probability p.
+/// @details Draws the gaps between the selected positions from the geometric
+/// distribution, so the number of draws is proportional to the number of selected
+/// positions instead of the size.
+/// @param p selection probability
+/// @param size number of positions
+/// @param positions vector that is filled with the selected positions in ascending order
+void Random::random_positions(double p, int size, std::vector<int> &positions) {
+
+	positions.clear();
+
+	if (p <= 0.0) {
+		return;
+	}
+
+	if (p >= 1.0) {
+		for (int i = 0; i < size; i++) {
+			positions.push_back(i);
+		}
+		return;
+	}
+
+	double log_q = std::log1p(-p);
+	double u;
+	double skip;
+	long long position = -1;
+
+	while (true) {
+		// u in (0, 1] to avoid log(0)
+		if (!this->use_mt) {
+			u = 1.0 - this->uniform();
+		} else {
+			u = 1.0 - std::generate_canonical<double, 53>(rng);
+		}
+
+		skip = std::floor(std::log(u) / log_q);
+
+		if (skip >= size - position) {
+			return;
+		}
+
+		position += 1 + (long long) skip;
+
+		if (position >= size) {
+			return;
+		}
+
+		positions.push_back(position);
+	}
+}
+
+/// @brief Switches to the counter-based stream of a generation and index.
+/// @details The following draws only depend on the arguments, so streams can be used
+/// concurrently by different instances and restarted after a checkpoint. Setting a
+/// seed switches back to the sequential generator.
+/// @param p_seed global seed
+/// @param p_epoch epoch that separates the streams of the jobs
+/// @param p_generation generation number
+/// @param p_index index of the stream within the generation (e.g. offspring)
+void Random::set_stream(long long p_seed, long long p_epoch,
+		std::uint64_t p_generation, std::uint32_t p_index) {
+
+	// The key mixes the seed and the epoch by the splitmix64 finalizer
+	std::uint64_t key = (std::uint64_t) p_seed
+			+ 0x9e3779b97f4a7c15ULL * ((std::uint64_t) p_epoch + 1);
+	key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+	key ^= key >> 31;
+
+	this->philox.set_stream(key, p_generation, p_index);
+	this->streaming = true;
+	this->use_mt = false;
+}
+
+/// @brief Switches to a stream keyed by the seed and epoch of this instance.
+/// @param p_generation generation number
+/// @param p_index index of the stream within the generation
+void Random::set_stream(std::uint64_t p_generation, std::uint32_t p_index) {
+	this->set_stream(this->global_seed, this->stream_epoch, p_generation,
+			p_index);
+}
+
 void Random::set_seed(long long p_global_seed) {
 	this->global_seed = p_global_seed;
 	rng.seed(this->global_seed);
+	xoshiro.seed(this->global_seed);
+	this->streaming = false;
+	this->use_mt = !this->use_xoshiro;
 }
 
 void Random::set_random_seed() {
 	this->global_seed =
 			chrono::high_resolution_clock::now().time_since_epoch().count();
 	rng.seed(this->global_seed);
+	xoshiro.seed(this->global_seed);
+	this->streaming = false;
+	this->use_mt = !this->use_xoshiro;
 	this->parameters->set_global_seed(this->global_seed);
 }
 
 long long Random::get_global_seed() const {
 	return this->global_seed;
 }
+
+/// @brief Returns the epoch of the streams, which is advanced for every job.
+long long Random::get_stream_epoch() const {
+	return this->stream_epoch;
+}
+
+void Random::set_stream_epoch(long long p_stream_epoch) {
+	this->stream_epoch = p_stream_epoch;
+}
@@ -19,21 +19,45 @@
 #include <iostream>
 #include <chrono>
 #include <memory>
+#include <vector>
+#include <cstdint>
 
+#include "Xoshiro256.h"
+#include "Philox.h"
 #include "../parameters/Parameters.h"
 
 using namespace std;
 
 /// @brief Class to represent a random generator instance. 
-/// @details Uses the mt19937 random genrator. 
+/// @details Uses the xoshiro256** generator with bounded integers by Lemire's method,
+/// or the mt19937 with the distributions of the standard library, which draws the
+/// same numbers as earlier versions (see the rng_type parameter). Alternatively, the draws
+/// are taken from a counter-based Philox stream that is selected by the seed, an
+/// epoch, the generation and an index (see set_stream()), so they do not depend on
+/// the draws made before.
 class Random {
 private:
 	long long global_seed;
 	std::random_device rd;
 	std::mt19937 rng;
+	Xoshiro256 xoshiro;
+	Philox4x32 philox;
+
+	bool use_xoshiro;
+	bool streaming;
+
+	// Draws with the mt19937 and the standard distributions
+	bool use_mt;
+
+	long long stream_epoch;
 
 	std::shared_ptr<Parameters> parameters;
 
+	void init_generator();
+	std::uint64_t next();
+	std::uint32_t bounded(std::uint64_t range);
+	double uniform();
+
 public:
 	Random(long long p_global_seed, std::shared_ptr<Parameters> p_parameters);
 	Random(std::shared_ptr<Parameters> p_parameters);
@@ -43,9 +67,22 @@ public:
 	float random_float(float a, float b);
 	bool random_bool(float p = 0.5);
 
+	void random_genes(int n, int size, const int *lower, const int *upper,
+			int *positions, int *values);
+	void random_integers(const int *lower, const int *upper,
+			const int *positions, int n, int *values);
+	void random_positions(double p, int size, std::vector<int> &positions);
+
+	void set_stream(long long p_seed, long long p_epoch,
+			std::uint64_t p_generation, std::uint32_t p_index);
+	void set_stream(std::uint64_t p_generation, std::uint32_t p_index);
+
 	void set_seed(long long p_global_seed);
 	void set_random_seed();
 	long long get_global_seed() const;
+
+	long long get_stream_epoch() const;
+	void set_stream_epoch(long long p_stream_epoch);
 };
 
 
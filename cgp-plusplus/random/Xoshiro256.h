@@ -0,0 +1,77 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: Xoshiro256.h
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+#ifndef RANDOM_XOSHIRO256_H_
+#define RANDOM_XOSHIRO256_H_
+
+#include <cstdint>
+#include <limits>
+
+/// @brief xoshiro256** generator by Blackman and Vigna.
+/// @details Small-state (256 bit) generator that is considerably faster than the
+/// mt19937. Satisfies the UniformRandomBitGenerator requirements, so it can be
+/// used with the distributions of the standard library.
+/// @see Blackman, Vigna (2021): Scrambled Linear Pseudorandom Number Generators
+/// https://doi.org/10.1145/3460772
+class Xoshiro256 {
+private:
+	std::uint64_t state[4];
+
+	static std::uint64_t rotl(std::uint64_t x, int k) {
+		return (x << k) | (x >> (64 - k));
+	}
+
+public:
+	typedef std::uint64_t result_type;
+
+	Xoshiro256(std::uint64_t p_seed = 1) {
+		seed(p_seed);
+	}
+
+	/// @brief Seeds the state by means of the splitmix64 generator.
+	/// @details Avoids the all-zero state and decorrelates neighbouring seeds.
+	/// @param p_seed seed
+	void seed(std::uint64_t p_seed) {
+		for (int i = 0; i < 4; i++) {
+			p_seed += 0x9e3779b97f4a7c15ULL;
+			std::uint64_t z = p_seed;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			state[i] = z ^ (z >> 31);
+		}
+	}
+
+	result_type operator()() {
+		const std::uint64_t result = rotl(state[1] * 5, 7) * 9;
+		const std::uint64_t t = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+
+		return result;
+	}
+
+	static constexpr result_type min() {
+		return 0;
+	}
+
+	static constexpr result_type max() {
+		return std::numeric_limits<result_type>::max();
+	}
+};
+
+#endif /* RANDOM_XOSHIRO256_H_ */
@@ -49,8 +49,10 @@ public:
 			std::shared_ptr<Random> p_random,
 			std::shared_ptr<Species<G>> p_species);
 	virtual ~Recombination() = default;
-	void crossover(std::shared_ptr<Individual<G, F>> p1,
-			std::shared_ptr<Individual<G, F>> p2);
+	void crossover(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2);
+	void crossover_first(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2);
 	void print();
 };
 
@@ -98,11 +100,23 @@ Recombination<G, F>::Recombination(std::shared_ptr<Parameters> p_parameters,
 /// @param p1 first parent 
 /// @param p2 second parent
 template<class G, class F>
-void Recombination<G, F>::crossover(std::shared_ptr<Individual<G, F>> p1,
-		std::shared_ptr<Individual<G, F>> p2) {
+void Recombination<G, F>::crossover(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
 	this->op->variate(p1, p2);
 }
 
+/// @brief Trigger the recombination procedure for the first child only.
+/// @details The second parent is left unchanged, so it can be passed directly
+/// instead of a copy.
+/// @param p1 first parent, overwritten by the first child
+/// @param p2 second parent
+template<class G, class F>
+void Recombination<G, F>::crossover_first(
+		const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
+	this->op->variate_first(p1, p2);
+}
+
 /// @brief Print the recobination name. 
 template<class G, class F>
 void Recombination<G, F>::print() {
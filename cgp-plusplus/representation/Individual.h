@@ -20,6 +20,7 @@
 #include <iterator>
 #include <string>
 #include <sstream>
+#include <cstdint>
 
 /// @brief Class to represent integer-based and real-encoded CGP individuals.
 /// @details Provides methods to handle the genome, active nodes and symbolic expressions.
@@ -33,10 +34,19 @@ private:
 
 	F fitness;
 	bool evaluated = false;
+
+	std::uint64_t phenotype_hash = 0;
+
+	bool pruned = false;
+	bool screened = false;
+
+	int hits = -1;
 public:
 	Individual(std::shared_ptr<Random> p_random,
-			std::shared_ptr<Parameters> p_parameters);
-	Individual(std::shared_ptr<Individual<G, F>> individual);
+			std::shared_ptr<Parameters> p_parameters,
+			std::shared_ptr<const typename Species<G>::GeneTable> p_gene_table =
+					nullptr);
+	Individual(const std::shared_ptr<Individual<G, F>> &individual);
 	virtual ~Individual() = default;
 
 	void reset_genome();
@@ -60,7 +70,20 @@ public:
 	bool is_evaluated() const;
 	void set_evaluated(bool p_evaluated);
 
-	void copy_genome(std::shared_ptr<G[]> p_genome);
+	void copy_genome(const G *p_genome);
+	void copy_from(const Individual<G, F> &individual);
+
+	std::uint64_t get_phenotype_hash() const;
+	void set_phenotype_hash(std::uint64_t p_phenotype_hash);
+
+	bool is_pruned() const;
+	void set_pruned(bool p_pruned);
+
+	bool is_screened() const;
+	void set_screened(bool p_screened);
+
+	int get_hits() const;
+	void set_hits(int p_hits);
 
 	const std::string to_string(std::string delimiter=" ") const;
 	const std::shared_ptr<std::vector<int> >& get_active_nodes() const;
@@ -75,10 +98,12 @@ public:
 /// @brief Constructor to intialize the expression and active node vectors
 /// @param p_random shared pointer to random generator instance
 /// @param p_parameters shared pointer to parameter object
+/// @param p_gene_table gene table to share, nullptr to calculate it
 template<class G, class F>
 Individual<G,F>::Individual(std::shared_ptr<Random> p_random,
-		std::shared_ptr<Parameters> p_parameters) :
-		Species<G>(p_random, p_parameters) {
+		std::shared_ptr<Parameters> p_parameters,
+		std::shared_ptr<const typename Species<G>::GeneTable> p_gene_table) :
+		Species<G>(p_random, p_parameters, p_gene_table) {
 
 	std::shared_ptr<G[]> new_genome_ptr(new G[this->genome_size]());
 	this->genome = new_genome_ptr;
@@ -93,17 +118,25 @@ Individual<G,F>::Individual(std::shared_ptr<Random> p_random,
 /// @brief Copy constructor for deep cloning
 /// @param individual individual to clone
 template<class G, class F>
-Individual<G,F>::Individual(std::shared_ptr<Individual<G, F>> individual) :
-		Species<G>(individual->random, individual->parameters) {
+Individual<G,F>::Individual(const std::shared_ptr<Individual<G, F>> &individual) :
+		Species<G>(individual->random, individual->parameters,
+				individual->gene_table) {
 
 	std::shared_ptr<G[]> new_genome_ptr(new G[this->genome_size](), std::default_delete<G[]>());
 	this->genome = new_genome_ptr;
 
-	std::shared_ptr<G[]> genome_ptr = individual->get_genome();
-	std::copy( genome_ptr.get(), genome_ptr.get() + this->genome_size , this->genome.get());
+	const G *genome_ptr = individual->get_genome().get();
+	std::copy(genome_ptr, genome_ptr + this->genome_size, this->genome.get());
 
 	this->active_nodes =  std::make_shared<std::vector<int>>(*individual->active_nodes);
 	this->expressions = std::make_shared<std::vector<std::string>>(*individual->expressions);
+
+	this->fitness = individual->fitness;
+	this->evaluated = individual->evaluated;
+	this->phenotype_hash = individual->phenotype_hash;
+	this->pruned = individual->pruned;
+	this->screened = individual->screened;
+	this->hits = individual->hits;
 }
 
 /// @brief Returns a random integer in a open interval 
@@ -123,21 +156,19 @@ void Individual<G,F>::reset() {
 	this->reset_genome();
 	this->active_nodes->clear();
 	this->evaluated = false;
+	this->pruned = false;
+	this->screened = false;
+	this->hits = -1;
 }
 
 /// @brief Resets the genome according to the representation type 
 /// @details Distinguishes between integer and real-valued encoding
 template<class G, class F>
 void Individual<G,F>::reset_genome() {
-	int max_gene;
-	int min_gene;
-
 	for (int i = 0; i < this->genome_size; i++) {
 		if (std::is_same<int, G>::value) {
-			min_gene = this->min_gene(i);
-			max_gene = this->max_gene(i);
-			this->genome[i] = this->random_value_closed_interval(min_gene,
-					max_gene);
+			this->genome[i] = this->random_value_closed_interval(
+					this->min_genes[i], this->max_genes[i]);
 		} else {
 			this->genome[i] = this->random->random_float(0.0, 1.0);
 		}
@@ -211,12 +242,27 @@ const std::string Individual<G, F>::to_string(std::string delimiter) const {
 /// @brief Copy the genome that has been passed to the function
 /// @param p_genome shared pointer to genome array
 template<class G, class F>
-void Individual<G, F>::copy_genome(std::shared_ptr<G[]> p_genome) {
-
-	std::shared_ptr<G[]> genome_copy = std::make_shared<G[]>(this->genome_size);
+void Individual<G, F>::copy_genome(const G *p_genome) {
+	std::copy(p_genome, p_genome + this->genome_size, this->genome.get());
+}
 
-	std::copy(p_genome.get(), p_genome.get() + this->genome_size, genome_copy.get());
-	this->genome = genome_copy;
+/// @brief Overwrites the individual with the genome and state of another individual.
+/// @details Reuses the genome slot and the vectors of this individual, so breeding
+/// into a preallocated offspring does not allocate once the vectors have grown.
+/// @param individual individual to copy
+template<class G, class F>
+void Individual<G, F>::copy_from(const Individual<G, F> &individual) {
+	this->copy_genome(individual.get_genome().get());
+
+	*this->active_nodes = *individual.active_nodes;
+	*this->expressions = *individual.expressions;
+
+	this->fitness = individual.fitness;
+	this->evaluated = individual.evaluated;
+	this->phenotype_hash = individual.phenotype_hash;
+	this->pruned = individual.pruned;
+	this->screened = individual.screened;
+	this->hits = individual.hits;
 }
 
 /// @brief Trigger deep cloning via copy constructor
@@ -253,9 +299,65 @@ bool Individual<G, F>::is_evaluated() const {
 	return evaluated;
 }
 
+/// @brief Marks the individual as evaluated or not evaluated.
+/// @details The recorded hits belong to the evaluated phenotype, so they are
+/// discarded when the individual has to be evaluated again (e.g. after a mutation).
 template<class G, class F>
 void Individual<G, F>::set_evaluated(bool p_evaluated) {
 	this->evaluated = p_evaluated;
+
+	if (!p_evaluated) {
+		this->hits = -1;
+	}
+}
+
+/// @brief Returns the canonical hash of the active graph computed by the decoder.
+template<class G, class F>
+std::uint64_t Individual<G, F>::get_phenotype_hash() const {
+	return phenotype_hash;
+}
+
+template<class G, class F>
+void Individual<G, F>::set_phenotype_hash(std::uint64_t p_phenotype_hash) {
+	this->phenotype_hash = p_phenotype_hash;
+}
+
+/// @brief Returns whether the evaluation has been aborted by racing.
+/// @details The fitness of a pruned individual is a lower bound (minimization)
+/// that exceeds the cut-off bound of the evaluation.
+template<class G, class F>
+bool Individual<G, F>::is_pruned() const {
+	return pruned;
+}
+
+template<class G, class F>
+void Individual<G, F>::set_pruned(bool p_pruned) {
+	this->pruned = p_pruned;
+}
+
+/// @brief Returns whether the individual has been rejected by the screening.
+/// @details The fitness of a screened individual has been evaluated on the screening
+/// instances only. It is not comparable to fully evaluated individuals.
+template<class G, class F>
+bool Individual<G, F>::is_screened() const {
+	return screened;
+}
+
+template<class G, class F>
+void Individual<G, F>::set_screened(bool p_screened) {
+	this->screened = p_screened;
+}
+
+/// @brief Returns the number of correctly classified samples of the last evaluation.
+/// @details Recorded by problems that classify samples (e.g. MNIST), -1 if unknown.
+template<class G, class F>
+int Individual<G, F>::get_hits() const {
+	return hits;
+}
+
+template<class G, class F>
+void Individual<G, F>::set_hits(int p_hits) {
+	this->hits = p_hits;
 }
 
 template<class G, class F>
@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 #include <cmath>
+#include <cstdint>
 
 #include "../random/Random.h"
 #include "../parameters/Parameters.h"
@@ -34,6 +35,14 @@ public:
 	const int FUNCTION_GENE = 1;
 	const int OUTPUT_GENE = 2;
 
+	/// @brief Bounds and types of the genes at every position of the genome.
+	/// @details Depends only on the configuration, so it is shared by all individuals.
+	struct GeneTable {
+		std::vector<int> min_genes;
+		std::vector<int> max_genes;
+		std::vector<std::uint8_t> gene_types;
+	};
+
 protected:
 
 	bool real_valued = false;
@@ -50,33 +59,55 @@ protected:
 	int levels_back;
 
 	std::shared_ptr<G[]> genome;
+
+	std::shared_ptr<const GeneTable> gene_table;
+
+	// Raw views of the gene table for the lookups
+	const int *min_genes;
+	const int *max_genes;
+	const std::uint8_t *gene_types;
+
+	std::shared_ptr<const GeneTable> calc_gene_table();
+	int calc_min_gene(int position);
+	int calc_max_gene(int position);
+	int calc_gene_type(int position);
+
 	std::shared_ptr<Random> random;
 	std::shared_ptr<Parameters> parameters;
 
 public:
 	Species(std::shared_ptr<Random> p_random,
-			std::shared_ptr<Parameters> p_parameters);
+			std::shared_ptr<Parameters> p_parameters,
+			std::shared_ptr<const GeneTable> p_gene_table = nullptr);
 	virtual ~Species() = default;
 
 	int calc_genome_size();
-	int max_gene(int position);
-	int min_gene(int position);
-	int decode_genotype_at(int position);
+	int max_gene(int position) const;
+	int min_gene(int position) const;
+	int decode_genotype_at(int position) const;
 	int node_number_from_position(int position);
 	int position_from_node_number(int node_number);
 	int interpret_float(float value, int position);
 	std::unique_ptr<int[]> float_to_int();
 
-	std::shared_ptr<G[]> get_genome() const;
+	const std::shared_ptr<G[]>& get_genome() const;
 	void set_genome(std::shared_ptr<G[]> genome);
 
+	const std::shared_ptr<const GeneTable>& get_gene_table() const;
+
 	bool is_real_valued() const;
 
 };
 
+/// @brief Constructor that sets up the dimensions and the gene table.
+/// @param p_random shared pointer to random generator instance
+/// @param p_parameters shared pointer to parameter object
+/// @param p_gene_table gene table of the same configuration to share,
+/// nullptr to calculate it
 template<class G>
 Species<G>::Species(std::shared_ptr<Random> p_random,
-		std::shared_ptr<Parameters> p_parameters) {
+		std::shared_ptr<Parameters> p_parameters,
+		std::shared_ptr<const GeneTable> p_gene_table) {
 
 	if (p_random == nullptr) {
 		throw std::invalid_argument("Random object is NULL!");
@@ -103,6 +134,16 @@ Species<G>::Species(std::shared_ptr<Random> p_random,
 	max_arity = parameters->get_max_arity();
 	genome_size = calc_genome_size();
 	levels_back = parameters->get_levels_back();
+
+	if (p_gene_table != nullptr) {
+		gene_table = p_gene_table;
+	} else {
+		gene_table = calc_gene_table();
+	}
+
+	min_genes = gene_table->min_genes.data();
+	max_genes = gene_table->max_genes.data();
+	gene_types = gene_table->gene_types.data();
 }
 
 /// @brief Calculates the size of the genome.
@@ -114,16 +155,69 @@ int Species<G>::calc_genome_size() {
 	return genome_size;
 }
 
+/// @brief Calculates the bounds and types of all genes of the configuration.
+/// @details Called once per configuration, the lookups use the resulting table.
+/// @return gene table
+template<class G>
+std::shared_ptr<const typename Species<G>::GeneTable> Species<G>::calc_gene_table() {
+
+	std::shared_ptr<GeneTable> table = std::make_shared<GeneTable>();
+
+	table->min_genes.resize(this->genome_size);
+	table->max_genes.resize(this->genome_size);
+	table->gene_types.resize(this->genome_size);
+
+	for (int position = 0; position < this->genome_size; position++) {
+		table->min_genes[position] = this->calc_min_gene(position);
+		table->max_genes[position] = this->calc_max_gene(position);
+		table->gene_types[position] = this->calc_gene_type(position);
+	}
+
+	return table;
+}
+
 /// @brief Returns the minimum gene for the given position.
 /// @details Depending on the type of the gene at the specified position. 
 /// @param position position in the genome
 /// @return minimum gene value
 template<class G>
-int Species<G>::min_gene(int position) {
-int max_arity = parameters->get_max_arity();
-    int num_inputs = parameters->get_num_inputs();
+int Species<G>::min_gene(int position) const {
+	return this->min_genes[position];
+}
+
+/// @brief Returns the maximum gene for the given position.
+/// @details Depending on the type of the gene at the specified position. 
+/// @param position position in the genome
+/// @return maximum gene value
+template<class G>
+int Species<G>::max_gene(int position) const {
+	return this->max_genes[position];
+}
+
+/// @brief Decodes the genotype at a specified position.
+/// @param position specified position
+/// @return phenotype at the specified position
+template<class G>
+int Species<G>::decode_genotype_at(int position) const {
+	return this->gene_types[position];
+}
+
+/// @brief Calculates the minimum gene for the given position.
+/// @param position position in the genome
+/// @return minimum gene value
+template<class G>
+int Species<G>::calc_min_gene(int position) {
     int gene_type = position % (max_arity + 1);
 
+    // Output genes address the last layer with fixed layers, otherwise any node
+    if (this->calc_gene_type(position) == this->OUTPUT_GENE) {
+        if (parameters->is_fixed_layers()) {
+            int width = parameters->get_levels_back();
+            return num_inputs + ((this->num_nodes - 1) / width) * width;
+        }
+        return 0;
+    }
+
     // Se è un gene Funzione (opcode), parte sempre da 0
     if (gene_type == 0) {
         return 0;
@@ -152,7 +246,6 @@ int max_arity = parameters->get_max_arity();
     }
     // Caso 2: Comportamento Standard (CGP classico)
     else {
-        int levels_back = parameters->get_levels_back();
         int min_val = node_idx_absolute - levels_back;
         if (min_val < 0) {
             return 0;
@@ -161,17 +254,18 @@ int max_arity = parameters->get_max_arity();
     }
 }
 
-/// @brief Returns the maximum gene for the given position.
-/// @details Depending on the type of the gene at the specified position. 
+/// @brief Calculates the maximum gene for the given position.
 /// @param position position in the genome
 /// @return maximum gene value
 template<class G>
-int Species<G>::max_gene(int position) {
-	int max_arity = parameters->get_max_arity();
-    int num_inputs = parameters->get_num_inputs();
-    int num_functions = parameters->get_num_functions();
+int Species<G>::calc_max_gene(int position) {
     int gene_type = position % (max_arity + 1);
 
+    // Output genes can address up to the last function node
+    if (this->calc_gene_type(position) == this->OUTPUT_GENE) {
+        return num_inputs + this->num_nodes - 1;
+    }
+
     // Se è un gene Funzione, ritorna l'indice massimo delle funzioni
     if (gene_type == 0) {
         return num_functions - 1;
@@ -205,11 +299,11 @@ int Species<G>::max_gene(int position) {
     }
 }
 
-/// @brief Decodes the genotype at a specified position.
+/// @brief Calculates the type of the gene at a specified position.
 /// @param position specified position
 /// @return phenotype at the specified position
 template<class G>
-int Species<G>::decode_genotype_at(int position) {
+int Species<G>::calc_gene_type(int position) {
 	if (position >= num_nodes * (max_arity + 1)) {
 		return this->OUTPUT_GENE;
 	} else if (position % (max_arity + 1) == 0) {
@@ -261,8 +355,7 @@ int Species<G>::interpret_float(float value, int position) {
 
 	} else if (this->decode_genotype_at(position) == this->FUNCTION_GENE) {
 
-		int num_functions = this->parameters->get_num_functions();
-		node_value = std::floor(value * num_functions);
+		node_value = std::floor(value * this->num_functions);
 
 	} else {
 		int node_term = this->num_inputs + this->num_nodes;
@@ -299,8 +392,11 @@ std::unique_ptr<int[]> Species<G>::float_to_int() {
 // Getter and setter of species class
 // ---------------------------------------------------------------------------
 
+/// @brief Returns the genome without copying the shared pointer.
+/// @details Hot paths should take the raw array via get_genome().get() so that
+/// the reference count is not touched for every gene read.
 template<class G>
-std::shared_ptr<G[]> Species<G>::get_genome() const {
+const std::shared_ptr<G[]>& Species<G>::get_genome() const {
 	return genome;
 }
 
@@ -309,6 +405,11 @@ void Species<G>::set_genome(std::shared_ptr<G[]> genome) {
 	this->genome = genome;
 }
 
+template<class G>
+const std::shared_ptr<const typename Species<G>::GeneTable>& Species<G>::get_gene_table() const {
+	return gene_table;
+}
+
 template<class G>
 bool Species<G>::is_real_valued() const {
 	return real_valued;
@@ -0,0 +1,172 @@
+//	CGP++: Modern C++ Implementation of Cartesian Genetic Programming
+// ===============================================================================
+//	File: IncrementalEvaluationTest.cpp
+// ===============================================================================
+//
+// ===============================================================================
+//  Copyright (C) 2024
+//
+//
+//	License: Academic Free License v. 3.0
+// ================================================================================
+
+// Checks the incremental evaluation against the full evaluation. A one+lambda loop
+// is run on a random logic synthesis problem with the node cache of the parent. The
+// fitness of every offspring that is evaluated incrementally must equal the fitness
+// of a full evaluation of the same genome. The run is repeated with mini-batches,
+// which switch the evaluated instances and refill the cache during the run.
+//
+// Build and run: make check (in the build directory)
+
+#include "../parameters/Parameters.h"
+#include "../random/Random.h"
+#include "../representation/Species.h"
+#include "../representation/Individual.h"
+#include "../functions/BooleanFunctions.h"
+#include "../evaluator/Evaluator.h"
+#include "../evaluator/NodeCache.h"
+#include "../mutation/Mutation.h"
+#include "../problems/LogicSynthesisProblem.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+typedef unsigned int E;
+typedef int G;
+typedef double F;
+
+/// @brief Evolves a one+lambda population and compares the incremental with the full fitness.
+/// @param batch_size number of instances per mini-batch, 0 evaluates all instances
+/// @param batch_interval number of generations after which the mini-batch is switched
+/// @return number of offspring whose fitness differs
+static int run(int batch_size, int batch_interval) {
+
+	const int num_inputs = 8;
+	const int num_outputs = 4;
+	const int num_instances = 64;
+	const int lambda = 4;
+	const int num_generations = 100;
+
+	std::shared_ptr<Parameters> parameters = std::make_shared<Parameters>();
+	parameters->set_num_variables(num_inputs);
+	parameters->set_num_constants(0);
+	parameters->set_num_inputs(num_inputs);
+	parameters->set_num_outputs(num_outputs);
+	parameters->set_num_function_nodes(200);
+	parameters->set_levels_back(200);
+	parameters->set_num_functions(8);
+	parameters->set_max_arity(2);
+	parameters->set_mutation_rate(0.05);
+	parameters->get_mutation_operators()->push_back(
+			parameters->PROBABILISTIC_POINT_MUTATION);
+	parameters->set_genome_size();
+
+	std::shared_ptr<Random> random = std::make_shared<Random>(1234, parameters);
+	std::shared_ptr<Species<G>> species = std::make_shared<Species<G>>(random,
+			parameters);
+	std::shared_ptr<Functions<E>> functions = std::make_shared<FunctionsBoolean<E>>(
+			parameters);
+	std::shared_ptr<Evaluator<E, G, F>> evaluator = std::make_shared<
+			Evaluator<E, G, F>>(parameters, functions, species);
+
+	std::shared_ptr<std::vector<std::vector<E>>> inputs = std::make_shared<
+			std::vector<std::vector<E>>>(num_instances, std::vector<E>(num_inputs));
+	std::shared_ptr<std::vector<std::vector<E>>> outputs = std::make_shared<
+			std::vector<std::vector<E>>>(num_instances, std::vector<E>(num_outputs));
+
+	for (int i = 0; i < num_instances; i++) {
+		for (E &input : inputs->at(i)) {
+			input = random->random_integer(0, 1 << 30);
+		}
+		for (E &output : outputs->at(i)) {
+			output = random->random_integer(0, 1 << 30);
+		}
+	}
+
+	std::shared_ptr<LogicSynthesisProblem<E, G, F>> problem = std::make_shared<
+			LogicSynthesisProblem<E, G, F>>(parameters, evaluator, inputs, outputs,
+			std::make_shared<std::vector<E>>(), num_instances);
+	problem->init_batches(batch_size);
+
+	Mutation<G, F> mutation(parameters, random, species);
+	NodeCache<E, G, F> cache(parameters, num_instances);
+	std::vector<NodeOverlay<E>> overlays(lambda);
+
+	std::shared_ptr<Individual<G, F>> parent = std::make_shared<Individual<G, F>>(
+			random, parameters);
+	problem->evaluate_individual(parent);
+	problem->cache_individual(parent, cache);
+
+	int mismatches = 0;
+
+	for (int generation = 1; generation <= num_generations; generation++) {
+
+		// The parent is re-evaluated on the new mini-batch and the cache refilled
+		if (problem->is_batched() && generation % batch_interval == 0) {
+			problem->next_batch();
+			cache.reset();
+
+			parent->set_evaluated(false);
+			problem->evaluate_individual(parent);
+			problem->cache_individual(parent, cache);
+		}
+
+		int selected = -1;
+		std::vector<std::shared_ptr<Individual<G, F>>> offspring(lambda);
+
+		for (int i = 0; i < lambda; i++) {
+			offspring[i] = std::make_shared<Individual<G, F>>(parent);
+			mutation.mutate(offspring[i]);
+
+			// Offspring with an unchanged phenotype are evaluated as well
+			offspring[i]->set_evaluated(false);
+
+			std::shared_ptr<Individual<G, F>> full = std::make_shared<
+					Individual<G, F>>(offspring[i]);
+
+			problem->evaluate_incremental(offspring[i], cache, overlays[i]);
+			problem->evaluate_individual(full);
+
+			if (offspring[i]->get_fitness() != full->get_fitness()) {
+				std::cerr << "Generation " << generation << ", offspring " << i
+						<< ": incremental fitness " << offspring[i]->get_fitness()
+						<< " differs from full fitness " << full->get_fitness()
+						<< std::endl;
+				mismatches++;
+			}
+
+			// Selection with neutral genetic drift
+			if (offspring[i]->get_fitness() <= parent->get_fitness()
+					&& (selected == -1
+							|| offspring[i]->get_fitness()
+									< offspring[selected]->get_fitness())) {
+				selected = i;
+			}
+		}
+
+		if (selected != -1) {
+			parent = offspring[selected];
+			cache.patch(parent, overlays[selected]);
+		}
+	}
+
+	return mismatches;
+}
+
+int main(int argc, char **argv) {
+
+	int failed = 0;
+
+	int mismatches = run(0, 1);
+	std::cout << "Incremental evaluation on all instances:   "
+			<< (mismatches == 0 ? "passed" : "FAILED") << std::endl;
+	failed += mismatches;
+
+	mismatches = run(16, 10);
+	std::cout << "Incremental evaluation on mini-batches:    "
+			<< (mismatches == 0 ? "passed" : "FAILED") << std::endl;
+	failed += mismatches;
+
+	return failed == 0 ? 0 : 1;
+}
@@ -49,7 +49,9 @@ public:
     }
 	static constexpr bool validate_mnist_type() {
         if constexpr (!std::is_same<unsigned int, EVALUATION_TYPE>::value) {
-			return false;
+			if constexpr (!std::is_same<unsigned long, EVALUATION_TYPE>::value) {
+				return false;
+			}
 		}
 		return true;
     }
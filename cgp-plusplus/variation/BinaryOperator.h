@@ -29,7 +29,11 @@ public:
 			std::shared_ptr<Species<G>> p_species) : GeneticOperator<G,F>(p_parameters, p_random, p_species) {}
 	virtual ~BinaryOperator() = default;
 
-	virtual void variate(std::shared_ptr<Individual<G, F>> p1, std::shared_ptr<Individual<G, F>> p2) = 0;
+	virtual void variate(const std::shared_ptr<Individual<G, F>> &p1, const std::shared_ptr<Individual<G, F>> &p2) = 0;
+
+	/// @brief Variates the first individual like variate() but leaves the second unchanged.
+	/// @details Used when only the first child of the recombination is kept.
+	virtual void variate_first(const std::shared_ptr<Individual<G, F>> &p1, const std::shared_ptr<Individual<G, F>> &p2) = 0;
 };
 
 #endif /* VARIATION_BINARYOPERATOR_H_ */
@@ -27,7 +27,7 @@ public:
 			std::shared_ptr<Random> p_random,
 			std::shared_ptr<Species<G>> p_species) : GeneticOperator<G,F>(p_parameters, p_random, p_species) {}
 	virtual ~UnaryOperator() = default;
-	virtual void variate(std::shared_ptr<Individual<G, F>> individual) = 0;
+	virtual void variate(const std::shared_ptr<Individual<G, F>> &individual) = 0;
 };
 
 #endif /* VARIATION_UNARYOPERATOR_H_ */
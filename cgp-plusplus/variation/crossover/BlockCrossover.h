@@ -48,8 +48,14 @@ public:
 			std::vector<int> &swap_nodes);
 	int calc_swap_index(int swap_node_number);
 
-	void variate(std::shared_ptr<Individual<G, F>> p1,
-			std::shared_ptr<Individual<G, F>> p2) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2) override;
+	void variate_first(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2) override;
+
+private:
+	void recombine(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2, bool both);
 };
 
 /// @brief Determines bunch of active nodes that are used for the swap by chance. 
@@ -94,8 +100,22 @@ int BlockCrossover<G, F>::calc_swap_index(int swap_node_number) {
 }
 
 template<class G, class F>
-void BlockCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
-		std::shared_ptr<Individual<G, F>> p2) {
+void BlockCrossover<G, F>::variate(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
+	this->recombine(p1, p2, true);
+}
+
+template<class G, class F>
+void BlockCrossover<G, F>::variate_first(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
+	this->recombine(p1, p2, false);
+}
+
+/// @brief Swaps the genes between the parents.
+/// @param both false to write the genes of the second parent into the first only
+template<class G, class F>
+void BlockCrossover<G, F>::recombine(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2, bool both) {
 
 	if (p1->num_active_nodes() == 0 || p2->num_active_nodes() == 0) {
 		return;
@@ -121,8 +141,8 @@ void BlockCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
 	std::shared_ptr<std::vector<int>> active_nodes1 = p1->get_active_nodes();
 	std::shared_ptr<std::vector<int>> active_nodes2 = p2->get_active_nodes();
 
-	std::shared_ptr<G[]> g1 = p1->get_genome();
-	std::shared_ptr<G[]> g2 = p2->get_genome();
+	G *g1 = p1->get_genome().get();
+	G *g2 = p2->get_genome().get();
 
 	determine_swap_nodes(block_size, *active_nodes1, swap_nodes1);
 	determine_swap_nodes(block_size, *active_nodes2, swap_nodes2);
@@ -141,7 +161,9 @@ void BlockCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
 		temp = g1[swap_index1];
 
 		g1[swap_index1] = g2[swap_index2];
-		g2[swap_index2] = temp;
+		if (both) {
+			g2[swap_index2] = temp;
+		}
 
 	}
 
@@ -41,13 +41,33 @@ public:
 
 	virtual ~DiscreteCrossover() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> p1,
-			std::shared_ptr<Individual<G, F>> p2) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2) override;
+	void variate_first(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2) override;
+
+private:
+	void recombine(const std::shared_ptr<Individual<G, F>> &p1,
+			const std::shared_ptr<Individual<G, F>> &p2, bool both);
 };
 
 template<class G, class F>
-void DiscreteCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
-		std::shared_ptr<Individual<G, F>> p2) {
+void DiscreteCrossover<G, F>::variate(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
+	this->recombine(p1, p2, true);
+}
+
+template<class G, class F>
+void DiscreteCrossover<G, F>::variate_first(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2) {
+	this->recombine(p1, p2, false);
+}
+
+/// @brief Swaps the genes between the parents.
+/// @param both false to write the genes of the second parent into the first only
+template<class G, class F>
+void DiscreteCrossover<G, F>::recombine(const std::shared_ptr<Individual<G, F>> &p1,
+		const std::shared_ptr<Individual<G, F>> &p2, bool both) {
 
 	if (p1->num_active_nodes() == 0 || p2->num_active_nodes() == 0) {
 		return;
@@ -60,8 +80,8 @@ void DiscreteCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
 	// Boundary extension is activated by default
 	bool boundary_extension = true;
 
-	std::shared_ptr<G[]> g1 = p1->get_genome();
-	std::shared_ptr<G[]> g2 = p2->get_genome();
+	G *g1 = p1->get_genome().get();
+	G *g2 = p2->get_genome().get();
 
 	// Node numbers are stored if two nodes are selected for the swap of the function gene
 	int swap_node1 = 0;
@@ -117,7 +137,9 @@ void DiscreteCrossover<G, F>::variate(std::shared_ptr<Individual<G, F>> p1,
 			// perform the swaps
 			tmp = g1[index1];
 			g1[index1] = g2[index2];
-			g2[index2] = tmp;
+			if (both) {
+				g2[index2] = tmp;
+			}
 		}
 	}
 
@@ -30,7 +30,7 @@ public:
 			std::shared_ptr<Species<G>> p_species);
 	virtual ~Duplication() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> individual) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &individual) override;
 };
 
 template<class G, class F>
@@ -51,7 +51,7 @@ Duplication<G, F>::Duplication(
 /// @param individual CGP individual to mutate
 template<class G, class F>
 void Duplication<G, F>::variate(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	int num_active_nodes = individual->num_active_nodes();
 
@@ -68,7 +68,7 @@ void Duplication<G, F>::variate(
 	int function;
 
 	std::shared_ptr<std::vector<int>> active_nodes = individual->get_active_nodes();
-	std::shared_ptr<G[]> genome = individual->get_genome();
+	G *genome = individual->get_genome().get();
 
 	// Determine a valid inversion depth by chance and get a suitable start index
 	depth = this->stochastic_depth(this->max_depth,
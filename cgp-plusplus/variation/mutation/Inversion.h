@@ -32,7 +32,7 @@ public:
 			std::shared_ptr<Species<G>> p_species);
 	virtual ~Inversion() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> individual) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &individual) override;
 };
 
 template<class G, class F>
@@ -53,7 +53,7 @@ Inversion<G, F>::Inversion(std::shared_ptr<Parameters> p_parameters,
 /// @param individual CGP individual to mutate
 template<class G, class F>
 void Inversion<G, F>::variate(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	int num_active_nodes =  individual->num_active_nodes();
 
@@ -75,7 +75,7 @@ void Inversion<G, F>::variate(
 	std::shared_ptr<std::vector<int>> active_nodes =
 			individual->get_active_nodes();
 
-	std::shared_ptr<G[]> genome = individual->get_genome();
+	G *genome = individual->get_genome().get();
 
 	// Determine a valid inversion depth by chance and get a suitable start index
 	depth = this->stochastic_depth(this->max_depth, num_active_nodes);
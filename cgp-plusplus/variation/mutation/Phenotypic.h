@@ -29,7 +29,7 @@ public:
 			std::shared_ptr<Species<G>> p_species) : UnaryOperator<G, F>(p_parameters, p_random, p_species) {};
 	virtual ~Phenotypic() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> individual) = 0;
+	void variate(const std::shared_ptr<Individual<G, F>> &individual) = 0;
 
 	int start_index(int num_active_nodes, int depth);
 	int stochastic_depth(int max_depth, int num_active_nodes);
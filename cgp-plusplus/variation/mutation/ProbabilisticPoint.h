@@ -15,6 +15,8 @@
 
 #include "../UnaryOperator.h"
 
+#include <vector>
+
 /// @brief Standard probabilistic point mutation commonly used in CGP. 
 /// @see Miller, J.F. (2011). Cartesian Genetic Programming.
 /// https://doi.org/10.1007/978-3-642-17310-3_2
@@ -24,13 +26,18 @@ template <class G, class F>
 class ProbabilisticPoint : public UnaryOperator<G,F> {
 private:
 	float mutation_rate;
+	bool per_gene;
+
+	// Positions and values of the mutated genes of one offspring
+	std::vector<int> positions;
+	std::vector<int> values;
 public:
 	ProbabilisticPoint(std::shared_ptr<Parameters> p_parameters,
 			std::shared_ptr<Random> p_random,
 			std::shared_ptr<Species<G>> p_species);
 	virtual ~ProbabilisticPoint() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> individual) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &individual) override;
 };
 
 template <class G, class F>
@@ -40,39 +47,61 @@ ProbabilisticPoint<G, F>::ProbabilisticPoint(std::shared_ptr<Parameters> p_param
 
 		this->name = "Probabilistic Point";
 		this->mutation_rate = this->parameters->get_mutation_rate();
+		this->per_gene = this->parameters->is_per_gene_mutation();
 }
 
 /// @brief Performs the standard (probabilistic) point mutation.
 /// @details Selects gene by chanc according to a mutation rate and mutates
-/// the gene values in the legal range. 
+/// the gene values in the legal range. By default, mutation_rate * genome_size
+/// positions are drawn. With per_gene_mutation, each gene is mutated with the
+/// mutation rate, the positions are sampled by geometric skipping. The positions and
+/// values of integer genomes are drawn in one call from the gene bound tables.
 /// @param individual CGP individual to mutate
 template <class G, class F>
-void ProbabilisticPoint<G, F>::variate(std::shared_ptr<Individual<G, F>> individual) {
+void ProbabilisticPoint<G, F>::variate(const std::shared_ptr<Individual<G, F>> &individual) {
 
-	std::shared_ptr<G[]> genome =  individual-> get_genome();
+	G *genome = individual->get_genome().get();
 
 	int genome_size = this->parameters->get_genome_size();
-	int max_gene;
-	int min_gene;
-
-	int num_mutations = this->mutation_rate * genome_size;
-	int random_pos;
+	int num_mutations;
+
+	if (this->per_gene) {
+		this->random->random_positions(this->mutation_rate, genome_size,
+				this->positions);
+		num_mutations = this->positions.size();
+	} else {
+		num_mutations = this->mutation_rate * genome_size;
+		this->positions.resize(num_mutations);
+	}
 
-	for (int i = 0; i < num_mutations; i++) {
+	if (this->species->is_real_valued()) {
+		for (int i = 0; i < num_mutations; i++) {
+			if (!this->per_gene) {
+				this->positions[i] = this->random->random_integer(0,
+						genome_size - 1);
+			}
+			genome[this->positions[i]] = this->random->random_float(0.0, 1.0);
+		}
+		return;
+	}
 
-		random_pos = this->random->random_integer(0, genome_size - 1);
+	const typename Species<G>::GeneTable &table = *this->species->get_gene_table();
 
-		if (this->species->is_real_valued()) {
-			genome[random_pos] = this->random->random_float(0.0, 1.0);
-		} else {
-			min_gene = this->species->min_gene(random_pos);
-			max_gene = this->species->max_gene(random_pos);
-			genome[random_pos] = this->random->random_integer(
-					min_gene, max_gene);
-		}
+	this->values.resize(num_mutations);
 
+	if (this->per_gene) {
+		this->random->random_integers(table.min_genes.data(),
+				table.max_genes.data(), this->positions.data(), num_mutations,
+				this->values.data());
+	} else {
+		this->random->random_genes(num_mutations, genome_size,
+				table.min_genes.data(), table.max_genes.data(),
+				this->positions.data(), this->values.data());
 	}
 
+	for (int i = 0; i < num_mutations; i++) {
+		genome[this->positions[i]] = this->values[i];
+	}
 }
 
 #endif /* VARIATION_POINTMUTATION_H_ */
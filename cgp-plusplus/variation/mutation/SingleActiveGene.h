@@ -31,7 +31,7 @@ public:
 
 	virtual ~SingleActiveGene() = default;
 
-	void variate(std::shared_ptr<Individual<G, F>> individual) override;
+	void variate(const std::shared_ptr<Individual<G, F>> &individual) override;
 };
 
 template <class G, class F>
@@ -45,10 +45,10 @@ SingleActiveGene<G, F>::SingleActiveGene(std::shared_ptr<Parameters> p_parameter
 /// @param individual CGP individual to mutate
 template<class G, class F>
 void SingleActiveGene<G, F>::variate(
-		std::shared_ptr<Individual<G, F>> individual) {
+		const std::shared_ptr<Individual<G, F>> &individual) {
 
 	std::shared_ptr<std::vector<int>> active_nodes = individual->get_active_nodes();
-	std::shared_ptr<G[]> genome =  individual-> get_genome();
+	G *genome = individual->get_genome().get();
 
 	int num_active_nodes = active_nodes->size();
 